@@ -23,10 +23,10 @@ PluginEditor::PluginEditor(PluginProcessor& p) :
                     zlpanel::getValue(state_, zlstate::PTooltipLang::kID)))) {
     // set font
 #if defined(JUCE_WINDOWS)
-    base_.font_ = juce::Typeface::createSystemTypefaceFor(
+    base_.font_ = base_.getSharedTypeface(
         BinaryData::InterSubsetMediumNoHinting_ttf, BinaryData::InterSubsetMediumNoHinting_ttfSize);
 #else
-    base_.font_ = juce::Typeface::createSystemTypefaceFor(
+    base_.font_ = base_.getSharedTypeface(
         BinaryData::InterSubsetMedium_ttf, BinaryData::InterSubsetMedium_ttfSize);
 #endif
     juce::LookAndFeel::getDefaultLookAndFeel().setDefaultSansSerifTypeface(base_.font_);
@@ -172,58 +172,70 @@ void PluginProcessor::processBlockBypassed(juce::AudioBuffer<double>& buffer, ju
 template <bool bypass>
 void PluginProcessor::processBlockInternal(juce::AudioBuffer<float>& buffer) {
     juce::ScopedNoDenormals no_denormals;
+    const zlchore::thread::RealtimeScope realtime_scope;
     if (buffer.getNumSamples() == 0) {
         return; // ignore empty blocks
     }
     if (update_channel_layout_per_call_) {
         updateChannelLayout();
     }
+    controller_.prepareBuffer();
     const auto c_ext_side = ext_side_.load(std::memory_order::relaxed) > .5f;
+    // side buffers are only built if some consumer reads them, otherwise they alias the main buffers
+    const auto c_side_on = controller_.isSideON();
+    const auto side_pointers = c_side_on ? side_pointers_ : main_pointers_;
     const auto num_samples = static_cast<size_t>(buffer.getNumSamples());
     switch (channel_layout_) {
     case kMain1Aux0: {
         zldsp::vector::copy(main_pointers_[0], buffer.getReadPointer(0), num_samples);
         zldsp::vector::copy(main_pointers_[1], main_pointers_[0], num_samples);
-        zldsp::vector::copy(side_pointers_[0], main_pointers_[0], num_samples);
-        zldsp::vector::copy(side_pointers_[1], side_pointers_[0], num_samples);
-        controller_.template process<bypass>(main_pointers_, side_pointers_, num_samples);
+        if (c_side_on) {
+            zldsp::vector::copy(side_pointers_[0], main_pointers_[0], num_samples);
+            zldsp::vector::copy(side_pointers_[1], side_pointers_[0], num_samples);
+        }
+        controller_.template process<bypass>(main_pointers_, side_pointers, num_samples);
         zldsp::vector::copy(buffer.getWritePointer(0), main_pointers_[0], num_samples);
         break;
     }
     case kMain1Aux1: {
         zldsp::vector::copy(main_pointers_[0], buffer.getReadPointer(0), num_samples);
         zldsp::vector::copy(main_pointers_[1], main_pointers_[0], num_samples);
-        if (c_ext_side) {
-            zldsp::vector::copy(side_pointers_[0], buffer.getReadPointer(1), num_samples);
-        } else {
-            zldsp::vector::copy(side_pointers_[0], main_pointers_[0], num_samples);
+        if (c_side_on) {
+            if (c_ext_side) {
+                zldsp::vector::copy(side_pointers_[0], buffer.getReadPointer(1), num_samples);
+            } else {
+                zldsp::vector::copy(side_pointers_[0], main_pointers_[0], num_samples);
+            }
+            zldsp::vector::copy(side_pointers_[1], side_pointers_[0], num_samples);
         }
-        zldsp::vector::copy(side_pointers_[1], side_pointers_[0], num_samples);
-        controller_.template process<bypass>(main_pointers_, side_pointers_, num_samples);
+        controller_.template process<bypass>(main_pointers_, side_pointers, num_samples);
         zldsp::vector::copy(buffer.getWritePointer(0), main_pointers_[0], num_samples);
         break;
     }
     case kMain1Aux2: {
         zldsp::vector::copy(main_pointers_[0], buffer.getReadPointer(0), num_samples);
         zldsp::vector::copy(main_pointers_[1], main_pointers_[0], num_samples);
-        if (c_ext_side) {
-            zldsp::vector::copy(side_pointers_[0], buffer.getReadPointer(1), num_samples);
-            zldsp::vector::copy(side_pointers_[1], buffer.getReadPointer(2), num_samples);
-        } else {
-            zldsp::vector::copy(side_pointers_[0], main_pointers_[0], num_samples);
-            zldsp::vector::copy(side_pointers_[1], main_pointers_[0], num_samples);
+        if (c_side_on) {
+            if (c_ext_side) {
+                zldsp::vector::copy(side_pointers_[0], buffer.getReadPointer(1), num_samples);
+                zldsp::vector::copy(side_pointers_[1], buffer.getReadPointer(2), num_samples);
+            } else {
+                zldsp::vector::copy(side_pointers_[0], main_pointers_[0], num_samples);
+                zldsp::vector::copy(side_pointers_[1], main_pointers_[0], num_samples);
+            }
         }
-
-        controller_.template process<bypass>(main_pointers_, side_pointers_, num_samples);
+        controller_.template process<bypass>(main_pointers_, side_pointers, num_samples);
         zldsp::vector::copy(buffer.getWritePointer(0), main_pointers_[0], num_samples);
         break;
     }
     case kMain2Aux0: {
         zldsp::vector::copy(main_pointers_[0], buffer.getReadPointer(0), num_samples);
         zldsp::vector::copy(main_pointers_[1], buffer.getReadPointer(1), num_samples);
-        zldsp::vector::copy(side_pointers_[0], main_pointers_[0], num_samples);
-        zldsp::vector::copy(side_pointers_[1], main_pointers_[1], num_samples);
-        controller_.template process<bypass>(main_pointers_, side_pointers_, num_samples);
+        if (c_side_on) {
+            zldsp::vector::copy(side_pointers_[0], main_pointers_[0], num_samples);
+            zldsp::vector::copy(side_pointers_[1], main_pointers_[1], num_samples);
+        }
+        controller_.template process<bypass>(main_pointers_, side_pointers, num_samples);
         zldsp::vector::copy(buffer.getWritePointer(0), main_pointers_[0], num_samples);
         zldsp::vector::copy(buffer.getWritePointer(1), main_pointers_[1], num_samples);
         break;
@@ -231,14 +243,16 @@ void PluginProcessor::processBlockInternal(juce::AudioBuffer<float>& buffer) {
     case kMain2Aux1: {
         zldsp::vector::copy(main_pointers_[0], buffer.getReadPointer(0), num_samples);
         zldsp::vector::copy(main_pointers_[1], buffer.getReadPointer(1), num_samples);
-        if (c_ext_side) {
-            zldsp::vector::copy(side_pointers_[0], buffer.getReadPointer(2), num_samples);
-            zldsp::vector::copy(side_pointers_[1], buffer.getReadPointer(2), num_samples);
-        } else {
-            zldsp::vector::copy(side_pointers_[0], main_pointers_[0], num_samples);
-            zldsp::vector::copy(side_pointers_[1], main_pointers_[1], num_samples);
+        if (c_side_on) {
+            if (c_ext_side) {
+                zldsp::vector::copy(side_pointers_[0], buffer.getReadPointer(2), num_samples);
+                zldsp::vector::copy(side_pointers_[1], buffer.getReadPointer(2), num_samples);
+            } else {
+                zldsp::vector::copy(side_pointers_[0], main_pointers_[0], num_samples);
+                zldsp::vector::copy(side_pointers_[1], main_pointers_[1], num_samples);
+            }
         }
-        controller_.template process<bypass>(main_pointers_, side_pointers_, num_samples);
+        controller_.template process<bypass>(main_pointers_, side_pointers, num_samples);
         zldsp::vector::copy(buffer.getWritePointer(0), main_pointers_[0], num_samples);
         zldsp::vector::copy(buffer.getWritePointer(1), main_pointers_[1], num_samples);
         break;
@@ -246,14 +260,16 @@ void PluginProcessor::processBlockInternal(juce::AudioBuffer<float>& buffer) {
     case kMain2Aux2: {
         zldsp::vector::copy(main_pointers_[0], buffer.getReadPointer(0), num_samples);
         zldsp::vector::copy(main_pointers_[1], buffer.getReadPointer(1), num_samples);
-        if (c_ext_side) {
-            zldsp::vector::copy(side_pointers_[0], buffer.getReadPointer(2), num_samples);
-            zldsp::vector::copy(side_pointers_[1], buffer.getReadPointer(3), num_samples);
-        } else {
-            zldsp::vector::copy(side_pointers_[0], main_pointers_[0], num_samples);
-            zldsp::vector::copy(side_pointers_[1], main_pointers_[1], num_samples);
+        if (c_side_on) {
+            if (c_ext_side) {
+                zldsp::vector::copy(side_pointers_[0], buffer.getReadPointer(2), num_samples);
+                zldsp::vector::copy(side_pointers_[1], buffer.getReadPointer(3), num_samples);
+            } else {
+                zldsp::vector::copy(side_pointers_[0], main_pointers_[0], num_samples);
+                zldsp::vector::copy(side_pointers_[1], main_pointers_[1], num_samples);
+            }
         }
-        controller_.template process<bypass>(main_pointers_, side_pointers_, num_samples);
+        controller_.template process<bypass>(main_pointers_, side_pointers, num_samples);
         zldsp::vector::copy(buffer.getWritePointer(0), main_pointers_[0], num_samples);
         zldsp::vector::copy(buffer.getWritePointer(1), main_pointers_[1], num_samples);
         break;
@@ -267,86 +283,100 @@ void PluginProcessor::processBlockInternal(juce::AudioBuffer<float>& buffer) {
 template <bool bypass>
 void PluginProcessor::processBlockInternal(juce::AudioBuffer<double>& buffer) {
     juce::ScopedNoDenormals no_denormals;
+    const zlchore::thread::RealtimeScope realtime_scope;
     if (buffer.getNumSamples() == 0) {
         return; // ignore empty blocks
     }
     if (update_channel_layout_per_call_) {
         updateChannelLayout();
     }
+    controller_.prepareBuffer();
     const auto c_ext_side = ext_side_.load(std::memory_order::relaxed) > .5f;
+    // side buffers are only built if some consumer reads them, otherwise they alias the main buffers
+    const auto c_side_on = controller_.isSideON();
+    // the main channels are processed in place, the side channels are always copied into the own buffers
+    auto main_pointers = main_pointers_;
     const auto num_samples = static_cast<size_t>(buffer.getNumSamples());
     switch (channel_layout_) {
     case kMain1Aux0: {
-        main_pointers_[0] = buffer.getWritePointer(0);
-        zldsp::vector::copy(main_pointers_[1], main_pointers_[0], num_samples);
-        zldsp::vector::copy(side_pointers_[0], main_pointers_[0], num_samples);
-        zldsp::vector::copy(side_pointers_[1], side_pointers_[0], num_samples);
-        controller_.template process<bypass>(main_pointers_, side_pointers_, num_samples);
+        main_pointers[0] = buffer.getWritePointer(0);
+        zldsp::vector::copy(main_pointers[1], main_pointers[0], num_samples);
+        if (c_side_on) {
+            zldsp::vector::copy(side_pointers_[0], main_pointers[0], num_samples);
+            zldsp::vector::copy(side_pointers_[1], side_pointers_[0], num_samples);
+        }
         break;
     }
     case kMain1Aux1: {
-        main_pointers_[0] = buffer.getWritePointer(0);
-        zldsp::vector::copy(main_pointers_[1], main_pointers_[0], num_samples);
-        if (c_ext_side) {
-            zldsp::vector::copy(side_pointers_[0], buffer.getReadPointer(1), num_samples);
-        } else {
-            zldsp::vector::copy(side_pointers_[0], main_pointers_[0], num_samples);
+        main_pointers[0] = buffer.getWritePointer(0);
+        zldsp::vector::copy(main_pointers[1], main_pointers[0], num_samples);
+        if (c_side_on) {
+            if (c_ext_side) {
+                zldsp::vector::copy(side_pointers_[0], buffer.getReadPointer(1), num_samples);
+            } else {
+                zldsp::vector::copy(side_pointers_[0], main_pointers[0], num_samples);
+            }
+            zldsp::vector::copy(side_pointers_[1], side_pointers_[0], num_samples);
         }
-        zldsp::vector::copy(side_pointers_[1], side_pointers_[0], num_samples);
-        controller_.template process<bypass>(main_pointers_, side_pointers_, num_samples);
         break;
     }
     case kMain1Aux2: {
-        main_pointers_[0] = buffer.getWritePointer(0);
-        zldsp::vector::copy(main_pointers_[1], main_pointers_[0], num_samples);
-        if (c_ext_side) {
-            zldsp::vector::copy(side_pointers_[0], buffer.getReadPointer(1), num_samples);
-            zldsp::vector::copy(side_pointers_[1], buffer.getReadPointer(2), num_samples);
-        } else {
-            zldsp::vector::copy(side_pointers_[0], main_pointers_[0], num_samples);
-            zldsp::vector::copy(side_pointers_[1], side_pointers_[0], num_samples);
+        main_pointers[0] = buffer.getWritePointer(0);
+        zldsp::vector::copy(main_pointers[1], main_pointers[0], num_samples);
+        if (c_side_on) {
+            if (c_ext_side) {
+                zldsp::vector::copy(side_pointers_[0], buffer.getReadPointer(1), num_samples);
+                zldsp::vector::copy(side_pointers_[1], buffer.getReadPointer(2), num_samples);
+            } else {
+                zldsp::vector::copy(side_pointers_[0], main_pointers[0], num_samples);
+                zldsp::vector::copy(side_pointers_[1], side_pointers_[0], num_samples);
+            }
         }
-        controller_.template process<bypass>(main_pointers_, side_pointers_, num_samples);
         break;
     }
     case kMain2Aux0: {
-        main_pointers_[0] = buffer.getWritePointer(0);
-        main_pointers_[1] = buffer.getWritePointer(1);
-        zldsp::vector::copy(side_pointers_[0], main_pointers_[0], num_samples);
-        zldsp::vector::copy(side_pointers_[1], main_pointers_[1], num_samples);
-        controller_.template process<bypass>(main_pointers_, side_pointers_, num_samples);
+        main_pointers[0] = buffer.getWritePointer(0);
+        main_pointers[1] = buffer.getWritePointer(1);
+        if (c_side_on) {
+            zldsp::vector::copy(side_pointers_[0], main_pointers[0], num_samples);
+            zldsp::vector::copy(side_pointers_[1], main_pointers[1], num_samples);
+        }
         break;
     }
     case kMain2Aux1: {
-        main_pointers_[0] = buffer.getWritePointer(0);
-        main_pointers_[1] = buffer.getWritePointer(1);
-        if (c_ext_side) {
-            zldsp::vector::copy(side_pointers_[0], buffer.getReadPointer(2), num_samples);
-            zldsp::vector::copy(side_pointers_[1], side_pointers_[0], num_samples);
-        } else {
-            zldsp::vector::copy(side_pointers_[0], main_pointers_[0], num_samples);
-            zldsp::vector::copy(side_pointers_[1], main_pointers_[1], num_samples);
+        main_pointers[0] = buffer.getWritePointer(0);
+        main_pointers[1] = buffer.getWritePointer(1);
+        if (c_side_on) {
+            if (c_ext_side) {
+                zldsp::vector::copy(side_pointers_[0], buffer.getReadPointer(2), num_samples);
+                zldsp::vector::copy(side_pointers_[1], side_pointers_[0], num_samples);
+            } else {
+                zldsp::vector::copy(side_pointers_[0], main_pointers[0], num_samples);
+                zldsp::vector::copy(side_pointers_[1], main_pointers[1], num_samples);
+            }
         }
-        controller_.template process<bypass>(main_pointers_, side_pointers_, num_samples);
         break;
     }
     case kMain2Aux2: {
-        main_pointers_[0] = buffer.getWritePointer(0);
-        main_pointers_[1] = buffer.getWritePointer(1);
-        if (c_ext_side) {
-            zldsp::vector::copy(side_pointers_[0], buffer.getReadPointer(2), num_samples);
-            zldsp::vector::copy(side_pointers_[1], buffer.getReadPointer(3), num_samples);
-        } else {
-            zldsp::vector::copy(side_pointers_[0], main_pointers_[0], num_samples);
-            zldsp::vector::copy(side_pointers_[1], main_pointers_[1], num_samples);
+        main_pointers[0] = buffer.getWritePointer(0);
+        main_pointers[1] = buffer.getWritePointer(1);
+        if (c_side_on) {
+            if (c_ext_side) {
+                zldsp::vector::copy(side_pointers_[0], buffer.getReadPointer(2), num_samples);
+                zldsp::vector::copy(side_pointers_[1], buffer.getReadPointer(3), num_samples);
+            } else {
+                zldsp::vector::copy(side_pointers_[0], main_pointers[0], num_samples);
+                zldsp::vector::copy(side_pointers_[1], main_pointers[1], num_samples);
+            }
         }
-        controller_.template process<bypass>(main_pointers_, side_pointers_, num_samples);
         break;
     }
     case kInvalid: {
         return;
     }
     }
+    const auto side_pointers = c_side_on ? side_pointers_ : main_pointers;
+    controller_.template process<bypass>(main_pointers, side_pointers, num_samples);
 }
 
 bool PluginProcessor::hasEditor() const {
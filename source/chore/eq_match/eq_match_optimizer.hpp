@@ -14,9 +14,11 @@
 #include "nlopt.hpp"
 #pragma GCC diagnostic pop
 
+#include <algorithm>
+#include <functional>
 #include <optional>
 
-#include "../../dsp/filter/ideal_filter/ideal.hpp"
+#include "../../dsp/filter/ideal_filter/ideal_batch.hpp"
 #include "../../dsp/vector/vector.hpp"
 
 namespace zlchore::eq_match {
@@ -40,6 +42,35 @@ namespace zlchore::eq_match {
             zldsp::vector::multiply(ws_.data(), freqs.data(), w_scale, ws_.size());
 
             res_.resize(freqs.size());
+            for (auto& res : batch_res_) {
+                res.resize(freqs.size());
+            }
+            batch_.prepare(ws_);
+
+            // the global search runs on every kCoarseStride-th point of the (log-spaced) grid
+            coarse_stride_ = ws_.size() >= kCoarseStride * kMinCoarseSize ? kCoarseStride : size_t(1);
+            for (size_t i = 0; i < ws_.size(); i += coarse_stride_) {
+                ws_coarse_.push_back(ws_[i]);
+            }
+            diffs_coarse_.resize(ws_coarse_.size());
+            batch_coarse_.prepare(ws_coarse_);
+        }
+
+        /**
+         * set the function which is called whenever the fitted filters change
+         * it receives the current filters and the current MSE, and is called on the fitting thread
+         * @param on_progress
+         */
+        void setOnProgress(std::function<void(std::span<const zldsp::filter::FilterParameters>, double)> on_progress) {
+            on_progress_ = std::move(on_progress);
+        }
+
+        /**
+         * set whether the global search runs on the decimated grid, it is on by default
+         * @param use_coarse_grid
+         */
+        void setUseCoarseGrid(const bool use_coarse_grid) {
+            use_coarse_grid_ = use_coarse_grid;
         }
 
         /**
@@ -59,40 +90,55 @@ namespace zlchore::eq_match {
             if (sum_sqr < kEps) {
                 return 0;
             }
-            std::vector filter_types{
-                zldsp::filter::FilterType::kPeak,
-                zldsp::filter::FilterType::kLowShelf,
-                zldsp::filter::FilterType::kHighShelf
-            };
-            std::vector<size_t> filter_orders{2, 4, 6};
-            size_t suggest_num_band = 0;
-            double previous_mse = 1e6;
-            for (size_t band = 0; band < num_band; ++band) {
-                if (should_return()) {
-                    return suggest_num_band > 0 ? suggest_num_band : paras.size();
-                }
-                const auto result = addOneFilter(filter_types, filter_orders, should_return);
-                if (!result.has_value()) {
-                    return suggest_num_band > 0 ? suggest_num_band : paras.size();
-                }
-                const auto [para, mse] = *result;
-                paras.emplace_back(para);
-                const auto delta_mse = previous_mse - mse;
-                previous_mse = mse;
-                if (delta_mse < suggest_threshold && suggest_num_band == 0) {
-                    suggest_num_band = band + 1;
-                }
-                if (delta_mse < kHighOrderEps) {
-                    filter_orders = {2};
-                }
-                if (delta_mse < kEps) {
-                    return suggest_num_band > 0 ? suggest_num_band : band;
-                }
-                if (should_return()) {
-                    return suggest_num_band > 0 ? suggest_num_band : band;
-                }
+            return addFilters(paras, num_band, should_return, suggest_threshold, 0, 1e6);
+        }
+
+        /**
+         * re-fit current diff starting from a previous solution
+         * each previous filter is refined in turn against the residual of all other filters with the local algorithms,
+         * filters which no longer reduce the MSE are removed,
+         * and new filters are searched globally only if the residual still justifies them
+         * falls back to a cold fit if the previous filters explain too little of the new diff,
+         * and compares with a cold fit if the re-fitted error stays large, since the previous optimum may be a trap
+         * @param paras where to store filters' paras, sorted by how much each filter reduces the MSE
+         * @param previous_paras the previous solution
+         * @param num_band maximum number of bands
+         * @param should_return check whether it should return early (like thread exit)
+         * @param suggest_threshold suggest threshold
+         * @return the suggest number of band that can make MSE less than suggest threshold
+         */
+        size_t refit(std::vector<zldsp::filter::FilterParameters>& paras,
+                     const std::span<const zldsp::filter::FilterParameters> previous_paras,
+                     const size_t num_band,
+                     const std::function<bool()>& should_return,
+                     const double suggest_threshold = 1.0) {
+            if (previous_paras.empty()) {
+                return fit(paras, num_band, should_return, suggest_threshold);
             }
-            return suggest_num_band > 0 ? suggest_num_band : num_band;
+            const zldsp::vector::aligned_vector<float> target{diffs_};
+            const auto target_mse = getMSE();
+            const auto warm_num_band = refine(paras, previous_paras, num_band, should_return,
+                                              suggest_threshold, target_mse);
+            if (!warm_num_band.has_value()) {
+                std::ranges::copy(target, diffs_.begin());
+                return fit(paras, num_band, should_return, suggest_threshold);
+            }
+            const auto warm_mse = getMSE();
+            if (should_return() || warm_mse < kEps || warm_mse <= kMaxWarmErrorRatio * target_mse) {
+                return *warm_num_band;
+            }
+            const auto warm_paras = paras;
+            const zldsp::vector::aligned_vector<float> warm_diffs{diffs_};
+            std::ranges::copy(target, diffs_.begin());
+            const auto cold_num_band = fit(paras, num_band, should_return, suggest_threshold);
+            // keep the warm solution unless a complete cold fit is better
+            if (should_return() || getMSE() >= warm_mse) {
+                paras = warm_paras;
+                std::ranges::copy(warm_diffs, diffs_.begin());
+                reportProgress(paras, warm_mse);
+                return *warm_num_band;
+            }
+            return cold_num_band;
         }
 
         /**
@@ -121,7 +167,7 @@ namespace zlchore::eq_match {
                     }
                     filter_.setOrder(filter_order);
                     std::vector<double> sol(kInitSol.begin(), kInitSol.begin() + sol_size);
-                    if (!fitFGQ(sol, kAlgos2, should_return).has_value()) {
+                    if (!fitFGQ(sol, kAlgos2, should_return, use_coarse_grid_).has_value()) {
                         return std::nullopt;
                     }
                     const auto mse = fitFGQ(sol, kAlgos1, should_return);
@@ -170,6 +216,13 @@ namespace zlchore::eq_match {
 
     private:
         static constexpr double kEps = 1e-3, kHighOrderEps = 4.;
+        // the decimation of the grid used by the global search, and the minimum size of the decimated grid
+        static constexpr size_t kCoarseStride = 2, kMinCoarseSize = 16;
+        // the maximum number of refinement sweeps over all previous filters
+        static constexpr size_t kRefitSweeps = 3;
+        // a warm start is abandoned if the previous filters leave more than this ratio of the target MSE,
+        // and compared with a cold fit if the re-fitted MSE stays above kMaxWarmErrorRatio of the target MSE
+        static constexpr double kMaxWarmResidualRatio = .5, kMaxWarmErrorRatio = .1;
 
         static constexpr std::array kAlgos1{
             nlopt::algorithm::LD_MMA, nlopt::algorithm::LD_SLSQP, nlopt::algorithm::LD_VAR2
@@ -187,31 +240,224 @@ namespace zlchore::eq_match {
         const std::array<double, 3> lower_bound_;
         const std::array<double, 3> upper_bound_;
 
+        // the value and the central differences of at most three variables
+        static constexpr size_t kMaxEvaluations = 7;
+
         zldsp::filter::Ideal<float, 6> filter_;
         zldsp::vector::aligned_vector<float> ws_;
         zldsp::vector::aligned_vector<float> diffs_;
         zldsp::vector::aligned_vector<float> res_;
+        zldsp::filter::IdealBatch<float, 6 * kMaxEvaluations, kMaxEvaluations> batch_;
+        std::array<zldsp::vector::aligned_vector<float>, kMaxEvaluations> batch_res_;
+        bool use_coarse_grid_{true};
+        size_t coarse_stride_{1};
+        zldsp::vector::aligned_vector<float> ws_coarse_;
+        zldsp::vector::aligned_vector<float> diffs_coarse_;
+        zldsp::filter::IdealBatch<float, 6 * kMaxEvaluations, kMaxEvaluations> batch_coarse_;
+        std::function<void(std::span<const zldsp::filter::FilterParameters>, double)> on_progress_;
+
+        struct Contribution {
+            zldsp::filter::FilterParameters para{};
+            zldsp::vector::aligned_vector<float> log_res{};
+            double delta_mse{1e6};
+            bool removed{false};
+        };
+
+        /**
+         * add filters greedily until the MSE stops improving
+         * @param paras where to append filters' paras
+         * @param num_band maximum number of bands
+         * @param should_return
+         * @param suggest_threshold
+         * @param suggest_num_band the suggest number of band of the existing filters, 0 if not found yet
+         * @param previous_mse the MSE with the existing filters
+         * @return the suggest number of band
+         */
+        size_t addFilters(std::vector<zldsp::filter::FilterParameters>& paras,
+                          const size_t num_band,
+                          const std::function<bool()>& should_return,
+                          const double suggest_threshold,
+                          size_t suggest_num_band,
+                          double previous_mse) {
+            std::vector filter_types{
+                zldsp::filter::FilterType::kPeak,
+                zldsp::filter::FilterType::kLowShelf,
+                zldsp::filter::FilterType::kHighShelf
+            };
+            std::vector<size_t> filter_orders{2, 4, 6};
+            for (size_t band = paras.size(); band < num_band; ++band) {
+                if (should_return()) {
+                    return suggest_num_band > 0 ? suggest_num_band : paras.size();
+                }
+                const auto result = addOneFilter(filter_types, filter_orders, should_return);
+                if (!result.has_value()) {
+                    return suggest_num_band > 0 ? suggest_num_band : paras.size();
+                }
+                const auto [para, mse] = *result;
+                paras.emplace_back(para);
+                reportProgress(paras, mse);
+                const auto delta_mse = previous_mse - mse;
+                previous_mse = mse;
+                if (delta_mse < suggest_threshold && suggest_num_band == 0) {
+                    suggest_num_band = band + 1;
+                }
+                if (delta_mse < kHighOrderEps) {
+                    filter_orders = {2};
+                }
+                if (delta_mse < kEps) {
+                    return suggest_num_band > 0 ? suggest_num_band : band;
+                }
+                if (should_return()) {
+                    return suggest_num_band > 0 ? suggest_num_band : band;
+                }
+            }
+            return suggest_num_band > 0 ? suggest_num_band : num_band;
+        }
+
+        /**
+         * the warm part of refit(), diffs_ holds the residual afterward
+         * @param target_mse the MSE of the diff without any filter
+         * @return the suggest number of band, or std::nullopt if the previous filters explain too little of the diff
+         */
+        std::optional<size_t> refine(std::vector<zldsp::filter::FilterParameters>& paras,
+                                     const std::span<const zldsp::filter::FilterParameters> previous_paras,
+                                     const size_t num_band,
+                                     const std::function<bool()>& should_return,
+                                     const double suggest_threshold,
+                                     const double target_mse) {
+            paras.clear();
+            // remove the responses of the previous filters from the diff
+            std::vector<Contribution> contributions;
+            contributions.reserve(std::min(previous_paras.size(), num_band));
+            for (const auto& para : previous_paras.first(std::min(previous_paras.size(), num_band))) {
+                auto& contribution = contributions.emplace_back();
+                contribution.para = para;
+                contribution.para.freq = std::clamp(para.freq, std::exp(lower_bound_[0]), std::exp(upper_bound_[0]));
+                contribution.para.gain = std::clamp(para.gain, kMinGain, kMaxGain);
+                contribution.para.q = std::clamp(para.q, std::exp(kMinQLog), std::exp(kMaxQLog));
+                contribution.log_res.resize(diffs_.size());
+                updateContribution(contribution);
+                zldsp::vector::sub(diffs_.data(), contribution.log_res.data(), diffs_.size());
+            }
+            // refine each filter against the residual of the others, until the MSE stops improving
+            double mse = getMSE();
+            if (mse > kMaxWarmResidualRatio * target_mse) {
+                // the target has moved too far from the previous solution
+                return std::nullopt;
+            }
+            bool is_stopped = false;
+            for (size_t sweep = 0; sweep < kRefitSweeps && !is_stopped; ++sweep) {
+                const auto sweep_mse = mse;
+                for (auto& contribution : contributions) {
+                    if (should_return()) {
+                        is_stopped = true;
+                        break;
+                    }
+                    if (contribution.removed) {
+                        continue;
+                    }
+                    zldsp::vector::add(diffs_.data(), contribution.log_res.data(), diffs_.size());
+                    const auto mse_without = getMSE();
+                    filter_.setFilterType(contribution.para.filter_type);
+                    filter_.setOrder(contribution.para.order);
+                    std::vector<double> sol{
+                        std::log(contribution.para.freq),
+                        contribution.para.gain * kGainScale,
+                        std::log(contribution.para.q)
+                    };
+                    const auto c_mse = fitFGQ(sol, kAlgos1, should_return);
+                    if (!c_mse.has_value()) {
+                        // keep the unrefined filter
+                        zldsp::vector::sub(diffs_.data(), contribution.log_res.data(), diffs_.size());
+                        is_stopped = true;
+                        break;
+                    }
+                    contribution.delta_mse = mse_without - *c_mse;
+                    if (contribution.delta_mse < kEps) {
+                        contribution.removed = true;
+                        mse = mse_without;
+                        continue;
+                    }
+                    contribution.para.freq = std::exp(sol[0]);
+                    contribution.para.gain = sol[1] / kGainScale;
+                    contribution.para.q = std::exp(sol[2]);
+                    updateContribution(contribution);
+                    zldsp::vector::sub(diffs_.data(), contribution.log_res.data(), diffs_.size());
+                    mse = getMSE();
+                }
+                if (sweep_mse - mse < kEps) {
+                    break;
+                }
+            }
+            // keep the remaining filters sorted by importance, so that a smaller band number keeps the best ones
+            std::erase_if(contributions, [](const Contribution& c) { return c.removed; });
+            std::stable_sort(contributions.begin(), contributions.end(),
+                             [](const Contribution& a, const Contribution& b) {
+                                 return a.delta_mse > b.delta_mse;
+                             });
+            size_t suggest_num_band = 0;
+            for (const auto& contribution : contributions) {
+                paras.emplace_back(contribution.para);
+                if (contribution.delta_mse < suggest_threshold && suggest_num_band == 0) {
+                    suggest_num_band = paras.size();
+                }
+            }
+            reportProgress(paras, mse);
+            if (mse < kEps || is_stopped) {
+                return suggest_num_band > 0 ? suggest_num_band : paras.size();
+            }
+            return addFilters(paras, num_band, should_return, suggest_threshold, suggest_num_band, mse);
+        }
+
+        void reportProgress(const std::span<const zldsp::filter::FilterParameters> paras, const double mse) const {
+            if (on_progress_) {
+                on_progress_(paras, mse);
+            }
+        }
+
+        /**
+         * update the log magnitude square response of a filter
+         * @param contribution
+         */
+        void updateContribution(Contribution& contribution) {
+            filter_.setFilterType(contribution.para.filter_type);
+            filter_.setOrder(contribution.para.order);
+            filter_.setFreq(contribution.para.freq);
+            filter_.setGain(contribution.para.gain);
+            filter_.setQ(contribution.para.q);
+            filter_.updateCoeffs();
+            filter_.updateMagnitudeSquare(ws_, contribution.log_res);
+            zldsp::vector::log<float, true>(contribution.log_res.data(), contribution.log_res.size());
+        }
+
+        /**
+         * @return the MSE of the current diff
+         */
+        [[nodiscard]] double getMSE() const {
+            double sum_sqr = 0.0;
+            for (const auto& diff : diffs_) {
+                sum_sqr += static_cast<double>(diff * diff);
+            }
+            return 100. * sum_sqr / static_cast<double>(diffs_.size());
+        }
 
         struct OptFData {
             size_t n;
             zldsp::filter::Ideal<float, 6>* filter;
-            float* ws;
+            zldsp::filter::IdealBatch<float, 6 * kMaxEvaluations, kMaxEvaluations>* batch;
+            std::array<zldsp::vector::aligned_vector<float>, kMaxEvaluations>* res;
             float* diffs;
-            float* res;
             const std::function<bool()>* should_return;
         };
 
         /**
-         * calculate MSE error of the
+         * add the response at the given solution to the batch
          * @param x freq (& gain & q) value
          * @param data outside data
-         * @return
+         * @param k the index of the evaluation
          */
         template <size_t sol_size>
-        static double calculateMSE(const std::span<double> x, const OptFData* data) {
-            if ((*data->should_return)()) {
-                throw nlopt::forced_stop{};
-            }
+        static void addEvaluation(const std::span<const double> x, const OptFData* data, const size_t k) {
             const auto filter = data->filter;
             if constexpr (sol_size >= 1) {
                 filter->setFreq(std::exp(x[0]));
@@ -223,12 +469,21 @@ namespace zlchore::eq_match {
                 }
             }
             filter->updateCoeffs();
-            filter->updateMagnitudeSquare(std::span(data->ws, data->n),
-                                          std::span(data->res, data->n));
+            data->batch->addMagnitudeSquare(*filter, std::span((*data->res)[k].data(), data->n));
+        }
+
+        /**
+         * calculate MSE error of an evaluated response
+         * @param data outside data
+         * @param k the index of the evaluation
+         * @return
+         */
+        static double calculateMSE(const OptFData* data, const size_t k) {
+            auto* res = (*data->res)[k].data();
             double sum_sqr = 0.0;
-            zldsp::vector::log<float, true>(data->res, data->n);
+            zldsp::vector::log<float, true>(res, data->n);
             for (size_t i = 0; i < data->n; ++i) {
-                const auto err = data->diffs[i] - data->res[i];
+                const auto err = data->diffs[i] - res[i];
                 sum_sqr += static_cast<double>(err * err);
             }
             return 100. * sum_sqr / static_cast<double>(data->n);
@@ -236,6 +491,7 @@ namespace zlchore::eq_match {
 
         /**
          * calculate error and gradient at the current solution
+         * the value and all central differences are evaluated in one batch
          * @param x freq (& gain & q) value
          * @param grad gradient
          * @param f_data outside data
@@ -243,20 +499,33 @@ namespace zlchore::eq_match {
          */
         template <size_t sol_size>
         static double func(const std::vector<double>& x, std::vector<double>& grad, void* f_data) {
+            static_assert(2 * sol_size + 1 <= kMaxEvaluations);
             const auto* data = static_cast<OptFData*>(f_data);
+            if ((*data->should_return)()) {
+                throw nlopt::forced_stop{};
+            }
             std::array<double, sol_size> x_temp;
             for (size_t i = 0; i < sol_size; ++i) {
                 x_temp[i] = x[i];
             }
-            const auto mse = calculateMSE<sol_size>(x_temp, data);
+            data->batch->clear();
+            addEvaluation<sol_size>(x_temp, data, 0);
             if (!grad.empty()) {
                 for (size_t i = 0; i < sol_size; ++i) {
                     const auto xi = x[i];
                     x_temp[i] = xi - kEps;
-                    const auto mse_l = calculateMSE<sol_size>(x_temp, data);
+                    addEvaluation<sol_size>(x_temp, data, 2 * i + 1);
                     x_temp[i] = xi + kEps;
-                    const auto mse_r = calculateMSE<sol_size>(x_temp, data);
+                    addEvaluation<sol_size>(x_temp, data, 2 * i + 2);
                     x_temp[i] = xi;
+                }
+            }
+            data->batch->process();
+            const auto mse = calculateMSE(data, 0);
+            if (!grad.empty()) {
+                for (size_t i = 0; i < sol_size; ++i) {
+                    const auto mse_l = calculateMSE(data, 2 * i + 1);
+                    const auto mse_r = calculateMSE(data, 2 * i + 2);
                     grad[i] = (mse_r - mse_l) / (2.0 * kEps);
                 }
             }
@@ -268,12 +537,22 @@ namespace zlchore::eq_match {
          * filter type and filter order should have been assigned
          * @param sol the solution vector, contains at most three doubles
          * @param algos a list of algorithms
-         * @return
+         * @param use_coarse whether to evaluate the MSE on the decimated grid
+         * @return the MSE on the evaluated grid
          */
         std::optional<double> fitFGQ(std::vector<double>& sol,
                                     const std::span<const nlopt::algorithm> algos,
-                                    const std::function<bool()>& should_return) {
-            OptFData data{ws_.size(), &filter_, ws_.data(), diffs_.data(), res_.data(), &should_return};
+                                    const std::function<bool()>& should_return,
+                                    const bool use_coarse = false) {
+            OptFData data{ws_.size(), &filter_, &batch_, &batch_res_, diffs_.data(), &should_return};
+            if (use_coarse) {
+                for (size_t i = 0; i < diffs_coarse_.size(); ++i) {
+                    diffs_coarse_[i] = diffs_[i * coarse_stride_];
+                }
+                data = {
+                    ws_coarse_.size(), &filter_, &batch_coarse_, &batch_res_, diffs_coarse_.data(), &should_return
+                };
+            }
             double best_mse = 1e6;
             std::vector<double> best_sol{sol.begin(), sol.end()};
             const std::vector<double> lower_bound{lower_bound_.begin(), lower_bound_.begin() + sol.size()};
@@ -0,0 +1,362 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "realtime_check.hpp"
+
+#if defined(ZL_RT_SAFETY_CHECK)
+
+#include <juce_core/juce_core.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#if defined(_WIN32)
+#include <malloc.h>
+#endif
+#if defined(__GLIBC__)
+#include <cerrno>
+#include <dlfcn.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <unistd.h>
+
+// the allocator and syscall entries of glibc, they are not declared in its headers
+extern "C" {
+    void* __libc_malloc(std::size_t size);
+    void* __libc_calloc(std::size_t num, std::size_t size);
+    void* __libc_realloc(void* ptr, std::size_t size);
+    void* __libc_memalign(std::size_t alignment, std::size_t size);
+    void __libc_free(void* ptr);
+    ssize_t __read(int fd, void* buf, std::size_t count);
+    ssize_t __write(int fd, const void* buf, std::size_t count);
+    int __nanosleep(const timespec* req, timespec* rem);
+    int __sched_yield();
+}
+#endif
+
+namespace zlchore::thread {
+    namespace {
+        thread_local int realtime_depth = 0;
+        // also raised while reporting, since the report itself allocates
+        thread_local int suspend_depth = 0;
+        std::atomic<int> num_violations{0};
+    }
+
+    void reportIfRealtime(const char* what) noexcept {
+        if (realtime_depth == 0 || suspend_depth > 0) {
+            return;
+        }
+        suspend_depth += 1;
+        num_violations.fetch_add(1, std::memory_order::relaxed);
+        juce::Logger::writeToLog(juce::String("real-time violation: ") + what + "\n"
+                                 + juce::SystemStats::getStackBacktrace());
+        suspend_depth -= 1;
+        jassertfalse;
+    }
+
+    int getNumRealtimeViolations() noexcept {
+        return num_violations.load(std::memory_order::relaxed);
+    }
+
+    RealtimeScope::RealtimeScope() noexcept {
+        realtime_depth += 1;
+    }
+
+    RealtimeScope::~RealtimeScope() noexcept {
+        realtime_depth -= 1;
+    }
+
+    NonRealtimeScope::NonRealtimeScope() noexcept {
+        suspend_depth += 1;
+    }
+
+    NonRealtimeScope::~NonRealtimeScope() noexcept {
+        suspend_depth -= 1;
+    }
+}
+
+namespace {
+    // with the glibc hooks below, operator new must not go through the hooked malloc and report twice
+    void* rawMalloc(const std::size_t size) noexcept {
+#if defined(__GLIBC__)
+        return __libc_malloc(size);
+#else
+        return std::malloc(size);
+#endif
+    }
+
+    void rawFree(void* ptr) noexcept {
+#if defined(__GLIBC__)
+        __libc_free(ptr);
+#else
+        std::free(ptr);
+#endif
+    }
+
+    void* allocate(const std::size_t size, const char* what) noexcept {
+        zlchore::thread::reportIfRealtime(what);
+        return rawMalloc(size == 0 ? 1 : size);
+    }
+
+    void* allocateAligned(const std::size_t size, const std::align_val_t alignment, const char* what) noexcept {
+        zlchore::thread::reportIfRealtime(what);
+        const auto align = static_cast<std::size_t>(alignment);
+        // aligned_alloc needs a size which is a multiple of the alignment
+        const auto aligned_size = (std::max(size, static_cast<std::size_t>(1)) + align - 1) / align * align;
+#if defined(_WIN32)
+        return _aligned_malloc(aligned_size, align);
+#elif defined(__GLIBC__)
+        return __libc_memalign(align, aligned_size);
+#else
+        return std::aligned_alloc(align, aligned_size);
+#endif
+    }
+
+    void deallocate(void* ptr, const char* what) noexcept {
+        if (ptr != nullptr) {
+            zlchore::thread::reportIfRealtime(what);
+        }
+        rawFree(ptr);
+    }
+
+    void deallocateAligned(void* ptr, const char* what) noexcept {
+        if (ptr != nullptr) {
+            zlchore::thread::reportIfRealtime(what);
+        }
+#if defined(_WIN32)
+        _aligned_free(ptr);
+#else
+        rawFree(ptr);
+#endif
+    }
+}
+
+// replace every global allocation function
+// the aligned forms do not forward to the plain ones in libstdc++, libc++ or the MSVC STL, so they are replaced too
+void* operator new(const std::size_t size) {
+    if (auto* ptr = allocate(size, "operator new")) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](const std::size_t size) {
+    if (auto* ptr = allocate(size, "operator new[]")) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(const std::size_t size, const std::nothrow_t&) noexcept {
+    return allocate(size, "operator new");
+}
+
+void* operator new[](const std::size_t size, const std::nothrow_t&) noexcept {
+    return allocate(size, "operator new[]");
+}
+
+void* operator new(const std::size_t size, const std::align_val_t alignment) {
+    if (auto* ptr = allocateAligned(size, alignment, "aligned operator new")) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](const std::size_t size, const std::align_val_t alignment) {
+    if (auto* ptr = allocateAligned(size, alignment, "aligned operator new[]")) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(const std::size_t size, const std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return allocateAligned(size, alignment, "aligned operator new");
+}
+
+void* operator new[](const std::size_t size, const std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return allocateAligned(size, alignment, "aligned operator new[]");
+}
+
+void operator delete(void* ptr) noexcept {
+    deallocate(ptr, "operator delete");
+}
+
+void operator delete[](void* ptr) noexcept {
+    deallocate(ptr, "operator delete[]");
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    deallocate(ptr, "operator delete");
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+    deallocate(ptr, "operator delete[]");
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+    deallocate(ptr, "operator delete");
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+    deallocate(ptr, "operator delete[]");
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept {
+    deallocateAligned(ptr, "aligned operator delete");
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept {
+    deallocateAligned(ptr, "aligned operator delete[]");
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept {
+    deallocateAligned(ptr, "aligned operator delete");
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept {
+    deallocateAligned(ptr, "aligned operator delete[]");
+}
+
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept {
+    deallocateAligned(ptr, "aligned operator delete");
+}
+
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept {
+    deallocateAligned(ptr, "aligned operator delete[]");
+}
+
+// on glibc, also replace the C allocation functions and the blocking calls which the audio thread may reach
+// they only take effect when this file is linked into the executable (e.g. the Standalone or realtime_check_test),
+// inside a dlopen-ed plugin the symbols of the host and libc are bound first
+#if defined(__GLIBC__)
+
+namespace {
+    template <typename Func>
+    Func* getNext(std::atomic<Func*>& next, const char* name) noexcept {
+        auto* func = next.load(std::memory_order::relaxed);
+        if (func == nullptr) {
+            func = reinterpret_cast<Func*>(dlsym(RTLD_NEXT, name));
+            next.store(func, std::memory_order::relaxed);
+        }
+        return func;
+    }
+
+    std::atomic<int (*)(pthread_mutex_t*)> next_mutex_lock{nullptr};
+    std::atomic<int (*)(pthread_rwlock_t*)> next_rwlock_rdlock{nullptr};
+    std::atomic<int (*)(pthread_rwlock_t*)> next_rwlock_wrlock{nullptr};
+    std::atomic<int (*)(pthread_cond_t*, pthread_mutex_t*)> next_cond_wait{nullptr};
+    std::atomic<int (*)(pthread_cond_t*, pthread_mutex_t*, const timespec*)> next_cond_timedwait{nullptr};
+    std::atomic<int (*)(clockid_t, int, const timespec*, timespec*)> next_clock_nanosleep{nullptr};
+}
+
+extern "C" {
+    void* malloc(const std::size_t size) noexcept {
+        zlchore::thread::reportIfRealtime("malloc");
+        return __libc_malloc(size);
+    }
+
+    void* calloc(const std::size_t num, const std::size_t size) noexcept {
+        zlchore::thread::reportIfRealtime("calloc");
+        return __libc_calloc(num, size);
+    }
+
+    void* realloc(void* ptr, const std::size_t size) noexcept {
+        zlchore::thread::reportIfRealtime("realloc");
+        return __libc_realloc(ptr, size);
+    }
+
+    void free(void* ptr) noexcept {
+        if (ptr != nullptr) {
+            zlchore::thread::reportIfRealtime("free");
+        }
+        __libc_free(ptr);
+    }
+
+    void* memalign(const std::size_t alignment, const std::size_t size) noexcept {
+        zlchore::thread::reportIfRealtime("memalign");
+        return __libc_memalign(alignment, size);
+    }
+
+    void* aligned_alloc(const std::size_t alignment, const std::size_t size) noexcept {
+        zlchore::thread::reportIfRealtime("aligned_alloc");
+        return __libc_memalign(alignment, size);
+    }
+
+    int posix_memalign(void** ptr, const std::size_t alignment, const std::size_t size) noexcept {
+        zlchore::thread::reportIfRealtime("posix_memalign");
+        if (alignment % sizeof(void*) != 0 || (alignment & (alignment - 1)) != 0) {
+            return EINVAL;
+        }
+        auto* res = __libc_memalign(alignment, size);
+        if (res == nullptr) {
+            return ENOMEM;
+        }
+        *ptr = res;
+        return 0;
+    }
+
+    // only the blocking forms, try_lock is the real-time safe way to share state with the audio thread
+    int pthread_mutex_lock(pthread_mutex_t* mutex) noexcept {
+        zlchore::thread::reportIfRealtime("pthread_mutex_lock");
+        return getNext(next_mutex_lock, "pthread_mutex_lock")(mutex);
+    }
+
+    int pthread_rwlock_rdlock(pthread_rwlock_t* rwlock) noexcept {
+        zlchore::thread::reportIfRealtime("pthread_rwlock_rdlock");
+        return getNext(next_rwlock_rdlock, "pthread_rwlock_rdlock")(rwlock);
+    }
+
+    int pthread_rwlock_wrlock(pthread_rwlock_t* rwlock) noexcept {
+        zlchore::thread::reportIfRealtime("pthread_rwlock_wrlock");
+        return getNext(next_rwlock_wrlock, "pthread_rwlock_wrlock")(rwlock);
+    }
+
+    int pthread_cond_wait(pthread_cond_t* cond, pthread_mutex_t* mutex) {
+        zlchore::thread::reportIfRealtime("pthread_cond_wait");
+        return getNext(next_cond_wait, "pthread_cond_wait")(cond, mutex);
+    }
+
+    int pthread_cond_timedwait(pthread_cond_t* cond, pthread_mutex_t* mutex, const timespec* abstime) {
+        zlchore::thread::reportIfRealtime("pthread_cond_timedwait");
+        return getNext(next_cond_timedwait, "pthread_cond_timedwait")(cond, mutex, abstime);
+    }
+
+    // std::this_thread::yield, the slow path of a spin lock
+    int sched_yield() noexcept {
+        zlchore::thread::reportIfRealtime("sched_yield");
+        return __sched_yield();
+    }
+
+    int nanosleep(const timespec* req, timespec* rem) {
+        zlchore::thread::reportIfRealtime("nanosleep");
+        return __nanosleep(req, rem);
+    }
+
+    int clock_nanosleep(const clockid_t clock_id, const int flags, const timespec* req, timespec* rem) {
+        zlchore::thread::reportIfRealtime("clock_nanosleep");
+        return getNext(next_clock_nanosleep, "clock_nanosleep")(clock_id, flags, req, rem);
+    }
+
+    // file and socket I/O, which includes the wake-up write of a message post on Linux
+    ssize_t read(const int fd, void* buf, const std::size_t count) {
+        zlchore::thread::reportIfRealtime("read");
+        return __read(fd, buf, count);
+    }
+
+    ssize_t write(const int fd, const void* buf, const std::size_t count) {
+        zlchore::thread::reportIfRealtime("write");
+        return __write(fd, buf, count);
+    }
+}
+
+#endif
+
+#endif
@@ -0,0 +1,74 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+namespace zlchore::thread {
+#if defined(ZL_RT_SAFETY_CHECK)
+    /**
+     * report a real-time violation with a stack trace if the current thread is inside a RealtimeScope
+     * @param what a short description of the violation, e.g. "operator new"
+     */
+    void reportIfRealtime(const char* what) noexcept;
+
+    /**
+     * @return the number of violations reported since the process started
+     */
+    int getNumRealtimeViolations() noexcept;
+#endif
+
+    /**
+     * mark the current thread as running the audio callback while the scope is alive
+     * with ZL_RT_SAFETY_CHECK, allocations inside the scope and the explicit checks below are reported,
+     * on glibc also malloc/free, blocking locks, sleeps and file I/O, otherwise the scope does nothing
+     */
+    class RealtimeScope {
+    public:
+#if defined(ZL_RT_SAFETY_CHECK)
+        RealtimeScope() noexcept;
+
+        ~RealtimeScope() noexcept;
+#else
+        RealtimeScope() noexcept = default;
+#endif
+
+        RealtimeScope(const RealtimeScope&) = delete;
+
+        RealtimeScope& operator=(const RealtimeScope&) = delete;
+    };
+
+    /**
+     * lift the checks of the enclosing RealtimeScope while the scope is alive
+     */
+    class NonRealtimeScope {
+    public:
+#if defined(ZL_RT_SAFETY_CHECK)
+        NonRealtimeScope() noexcept;
+
+        ~NonRealtimeScope() noexcept;
+#else
+        NonRealtimeScope() noexcept = default;
+#endif
+
+        NonRealtimeScope(const NonRealtimeScope&) = delete;
+
+        NonRealtimeScope& operator=(const NonRealtimeScope&) = delete;
+    };
+
+    /**
+     * check an operation which cannot be interposed on every platform, e.g. a message post
+     * @param what a short description of the operation
+     */
+    inline void checkRealtime([[maybe_unused]] const char* what) noexcept {
+#if defined(ZL_RT_SAFETY_CHECK)
+        reportIfRealtime(what);
+#endif
+    }
+}
@@ -12,35 +12,67 @@
 #include <vector>
 #include <array>
 #include <span>
+#include <atomic>
+#include <memory>
 
 #include "../../container/fifo/abstract_fifo.hpp"
-#include "../../lock/spin_lock.hpp"
 #include "../../vector/vector.hpp"
 
 namespace zldsp::analyzer {
     /**
      * an analyzer sender which pushes input samples into FIFOs
+     * the FIFOs are published as generations, each prepare() fills an idle generation and then publishes it
+     * readers pin a generation with tryAcquire() and never block the sender or each other
+     * a generation still pinned by a reader is retired lazily: prepare() skips it and frees its FIFOs on a later call
      * @tparam FloatType the float type of input audio buffers
      * @tparam kNum the number of analyzers
      */
     template <typename FloatType, size_t kNum>
     class AnalyzerSenderBase {
     public:
+        /**
+         * FIFOs and the settings they were prepared with, only the FIFO positions change once published
+         */
+        struct Generation {
+            size_t id{0};
+            double sample_rate{48000};
+            size_t max_num_samples{1};
+            std::array<size_t, kNum> num_channels{};
+            std::array<std::vector<std::vector<float>>, kNum> sample_fifos;
+            zldsp::container::AbstractFIFO abstract_fifo{0};
+            std::atomic<int> num_readers{0};
+        };
+
         explicit AnalyzerSenderBase() = default;
 
         void prepare(const double sample_rate,
                      const size_t max_num_samples,
                      const std::array<size_t, kNum> num_channels,
                      const double fifo_size_second) {
-            lock_.lock();
-            sample_rate_ = sample_rate;
-            max_num_samples_ = max_num_samples;
-            num_channels_ = num_channels;
-
-            setFIFOSize(std::max(max_num_samples,
-                                 static_cast<size_t>(std::round(sample_rate * fifo_size_second))),
-                        num_channels);
-            lock_.unlock();
+            auto* current = active_.load();
+            // free the FIFOs of retired generations which no reader holds any more
+            Generation* next = nullptr;
+            for (auto& generation : generations_) {
+                if (generation.get() == current || generation->num_readers.load() != 0) {
+                    continue;
+                }
+                if (next == nullptr) {
+                    next = generation.get();
+                } else {
+                    freeFIFOs(*generation);
+                }
+            }
+            // every idle generation is still pinned by a reader, add one instead of waiting for it
+            if (next == nullptr) {
+                next = generations_.emplace_back(std::make_unique<Generation>()).get();
+            }
+            next->id = current->id + 1;
+            next->sample_rate = sample_rate;
+            next->max_num_samples = max_num_samples;
+            next->num_channels = num_channels;
+            setFIFOSize(*next, std::max(max_num_samples,
+                                        static_cast<size_t>(std::round(sample_rate * fifo_size_second))));
+            active_.store(next);
         }
 
         /**
@@ -49,79 +81,103 @@ namespace zldsp::analyzer {
          * @param num_samples
          */
         void process(std::array<std::span<FloatType*>, kNum> buffers, const size_t num_samples) {
+            auto* active = active_.load(std::memory_order::acquire);
+            auto& abstract_fifo{active->abstract_fifo};
+            auto& sample_fifos{active->sample_fifos};
             // calculate free space
-            const int free_space = std::min(static_cast<int>(num_samples), abstract_fifo_.getNumFree());
+            const int free_space = std::min(static_cast<int>(num_samples), abstract_fifo.getNumFree());
             if (free_space == 0) { return; }
             // push samples
-            const auto range = abstract_fifo_.prepareToWrite(free_space);
+            const auto range = abstract_fifo.prepareToWrite(free_space);
             for (size_t i = 0; i < kNum; ++i) {
                 if (!is_on_[i]) { continue; }
                 const auto buffer = buffers[i];
                 if (range.block_size1 > 0) {
                     for (size_t chan = 0; chan < buffer.size(); ++chan) {
-                        vector::copy(sample_fifos_[i][chan].data() + static_cast<size_t>(range.start_index1),
+                        vector::copy(sample_fifos[i][chan].data() + static_cast<size_t>(range.start_index1),
                                      buffer[chan],
                                      static_cast<size_t>(range.block_size1));
                     }
                 }
                 if (range.block_size2 > 0) {
                     for (size_t chan = 0; chan < buffer.size(); ++chan) {
-                        vector::copy(sample_fifos_[i][chan].data() + static_cast<size_t>(range.start_index2),
+                        vector::copy(sample_fifos[i][chan].data() + static_cast<size_t>(range.start_index2),
                                      buffer[chan] + static_cast<size_t>(range.block_size1),
                                      static_cast<size_t>(range.block_size2));
                     }
                 }
             }
-            abstract_fifo_.finishWrite(free_space);
+            abstract_fifo.finishWrite(free_space);
         }
 
         void setON(const size_t idx, const bool on) {
             is_on_[idx] = on;
         }
 
-        zldsp::container::AbstractFIFO& getAbstractFIFO() {
-            return abstract_fifo_;
-        }
-
-        std::array<std::vector<std::vector<float>>, kNum>& getSampleFIFOs() {
-            return sample_fifos_;
+        /**
+         * pin the current generation for reading, must be paired with release()
+         * @return the pinned generation, or nullptr if a new generation has just been published
+         */
+        Generation* tryAcquire() {
+            auto* generation = active_.load();
+            generation->num_readers.fetch_add(1);
+            // prepare() may have picked the generation for reuse before the pin became visible
+            if (active_.load() != generation) {
+                generation->num_readers.fetch_sub(1);
+                return nullptr;
+            }
+            return generation;
         }
 
-        zldsp::lock::SpinLock& getLock() {
-            return lock_;
+        /**
+         * unpin a generation returned by tryAcquire()
+         * @param generation
+         */
+        static void release(Generation* generation) {
+            generation->num_readers.fetch_sub(1);
         }
 
         double getSampleRate() const {
-            return sample_rate_;
+            return active_.load(std::memory_order::acquire)->sample_rate;
         }
 
         std::array<size_t, kNum> getNumChannels() const {
-            return num_channels_;
+            return active_.load(std::memory_order::acquire)->num_channels;
         }
 
         size_t getMaxNumSamples() const {
-            return max_num_samples_;
+            return active_.load(std::memory_order::acquire)->max_num_samples;
         }
 
     protected:
-        zldsp::lock::SpinLock lock_;
+        // generations are only freed with the sender, so a reader may always touch the counter of a stale one
+        std::vector<std::unique_ptr<Generation>> generations_ = makeGenerations();
+        // the generation written by process() and pinned by readers
+        std::atomic<Generation*> active_{generations_[0].get()};
 
-        double sample_rate_{48000};
-        std::array<size_t, kNum> num_channels_;
-        size_t max_num_samples_{1};
+        std::array<bool, kNum> is_on_{};
 
-        std::array<std::vector<std::vector<float>>, kNum> sample_fifos_;
-        zldsp::container::AbstractFIFO abstract_fifo_{0};
+        static std::vector<std::unique_ptr<Generation>> makeGenerations() {
+            std::vector<std::unique_ptr<Generation>> generations;
+            generations.emplace_back(std::make_unique<Generation>());
+            generations.emplace_back(std::make_unique<Generation>());
+            return generations;
+        }
 
-        std::array<bool, kNum> is_on_{};
+        static void freeFIFOs(Generation& generation) {
+            for (auto& fifos : generation.sample_fifos) {
+                std::vector<std::vector<float>>().swap(fifos);
+            }
+        }
 
-        void setFIFOSize(const size_t fifo_size, const std::array<size_t, kNum> num_channels) {
-            abstract_fifo_.setCapacity(static_cast<int>(fifo_size));
+        static void setFIFOSize(Generation& generation, const size_t fifo_size) {
+            generation.abstract_fifo.setCapacity(static_cast<int>(fifo_size));
             for (size_t i = 0; i < kNum; ++i) {
-                sample_fifos_[i].resize(num_channels[i]);
-                for (size_t chan = 0; chan < num_channels[i]; ++chan) {
-                    sample_fifos_[i][chan].resize(fifo_size);
-                    std::fill(sample_fifos_[i][chan].begin(), sample_fifos_[i][chan].end(), 0.f);
+                generation.sample_fifos[i].resize(generation.num_channels[i]);
+                for (size_t chan = 0; chan < generation.num_channels[i]; ++chan) {
+                    generation.sample_fifos[i][chan].resize(fifo_size);
+                    std::fill(generation.sample_fifos[i][chan].begin(),
+                              generation.sample_fifos[i][chan].end(), 0.f);
                 }
             }
         }
@@ -11,7 +11,7 @@
 
 #include <complex>
 #include "../../fft/zldsp_fft_include.hpp"
-#include "../../fft/zldsp_fft_window.hpp"
+#include "../../fft/zldsp_fft_window_cache.hpp"
 #include "../../vector/vector.hpp"
 #include "../../container/fifo/fifo_base.hpp"
 #include "../analyzer_base/analyzer_receiver_base.hpp"
@@ -27,12 +27,10 @@ namespace zldsp::analyzer {
             fft_ = std::make_unique<zldsp::fft::RFFT<float>>(fft_order);
             const auto fft_size = fft_->get_size();
 
-            window_.resize(fft_size);
-            zldsp::fft::createPeriodicHanning(std::span{window_.data(), window_.size()});
-            const auto scale = 2.f / static_cast<float>(fft_size);
-            vector::multiply(window_.data(), scale, window_.size());
+            window_ = zldsp::fft::getSharedWindow(fft_size, zldsp::fft::WindowType::kHanning,
+                                                  2.f / static_cast<float>(fft_size));
             window_sqr_sum_ = 0.0;
-            for (const auto value : window_) {
+            for (const auto value : *window_) {
                 window_sqr_sum_ += static_cast<double>(value) * static_cast<double>(value);
             }
             fft_in_.resize(fft_size);
@@ -51,8 +49,8 @@ namespace zldsp::analyzer {
             return fft_out_;
         }
 
-        vector::aligned_vector<float>& getWindow() {
-            return window_;
+        const vector::aligned_vector<float>& getWindow() const {
+            return *window_;
         }
 
         [[nodiscard]] size_t getFFTSize() const {
@@ -68,7 +66,7 @@ namespace zldsp::analyzer {
         vector::aligned_vector<float> fft_out_;
 
         std::unique_ptr<zldsp::fft::RFFT<float>> fft_;
-        vector::aligned_vector<float> window_;
+        zldsp::fft::SharedWindow window_;
         double window_sqr_sum_{0.0};
     };
 }
@@ -0,0 +1,230 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "spectrum_blender.hpp"
+#include "../../vector/vector.hpp"
+
+namespace zldsp::analyzer {
+    namespace hn = hwy::HWY_NAMESPACE;
+
+    /**
+     * a precomputed mapping from three FFT resolutions onto a display frequency grid
+     * it produces the same power spectrum as scaling each resolution, SpectrumBlender::blend and SpectrumTilter::tilt
+     * (the tilt is applied as a power gain), each output point is a sum of at most four weighted source bins
+     */
+    class SpectrumPlan {
+    public:
+        static constexpr size_t kNumSources = 3;
+
+        explicit SpectrumPlan() = default;
+
+        /**
+         * rebuild the plan, call it when the sample rate, the FFT sizes or the grid change
+         * @param frequencies the display frequency grid
+         * @param spectrum_sizes the number of bins of the low, middle and high resolution spectrum
+         * @param sample_rate
+         * @param crossovers
+         */
+        void prepare(const std::span<const float> frequencies,
+                     const std::array<size_t, kNumSources> spectrum_sizes,
+                     const double sample_rate,
+                     const SpectrumBlender::Crossovers crossovers = {}) {
+            assert(frequencies.size() >= 2);
+            assert(std::ranges::all_of(spectrum_sizes, [](const size_t x) { return x >= 2; }));
+            assert(sample_rate > 0.0);
+            spectrum_sizes_ = spectrum_sizes;
+            const auto size = frequencies.size();
+            frequencies_.assign(frequencies.begin(), frequencies.end());
+            for (auto* v : {&mix_, &frac_a_, &frac_b_}) {
+                v->resize(size);
+            }
+            for (auto* v : {&w_a0_, &w_a1_, &w_b0_, &w_b1_, &tilt_gains_}) {
+                v->resize(size);
+            }
+            idx_a_.resize(size);
+            idx_b_.resize(size);
+            std::fill(tilt_gains_.begin(), tilt_gains_.end(), 1.f);
+            segments_.clear();
+
+            for (size_t i = 0; i < size; ++i) {
+                const auto frequency = frequencies[i];
+                size_t source_a{0}, source_b{kNumSources};
+                float mix{0.f};
+                if (frequency <= crossovers.low_start) {
+                    source_a = 0;
+                } else if (frequency < crossovers.low_end) {
+                    source_a = 0;
+                    source_b = 1;
+                    mix = (frequency - crossovers.low_start) / (crossovers.low_end - crossovers.low_start);
+                } else if (frequency <= crossovers.high_start) {
+                    source_a = 1;
+                } else if (frequency < crossovers.high_end) {
+                    source_a = 1;
+                    source_b = 2;
+                    mix = (frequency - crossovers.high_start) / (crossovers.high_end - crossovers.high_start);
+                } else {
+                    source_a = 2;
+                }
+                mix_[i] = mix;
+                locateBin(spectrum_sizes[source_a], frequency, sample_rate, idx_a_[i], frac_a_[i]);
+                if (source_b < kNumSources) {
+                    locateBin(spectrum_sizes[source_b], frequency, sample_rate, idx_b_[i], frac_b_[i]);
+                } else {
+                    idx_b_[i] = 0;
+                    frac_b_[i] = 0.f;
+                }
+                if (segments_.empty() || segments_.back().source_a != source_a
+                    || segments_.back().source_b != source_b) {
+                    segments_.push_back({i, i + 1, source_a, source_b});
+                } else {
+                    segments_.back().end = i + 1;
+                }
+            }
+            updateWeights();
+        }
+
+        /**
+         * set the linear power scale of each resolution
+         * @param scales
+         */
+        void setResolutionScales(const std::array<float, kNumSources> scales) {
+            scales_ = scales;
+            updateWeights();
+        }
+
+        /**
+         * set the tilt slope around 1kHz
+         * @param slope_per_oct the tilt slope in dB per octave
+         */
+        void setTiltSlope(const double slope_per_oct) {
+            assert(frequencies_.size() >= 2);
+            for (size_t i = 1; i < frequencies_.size(); ++i) {
+                const auto tilt_db = std::log2(static_cast<double>(frequencies_[i]) / 1000.0) * slope_per_oct;
+                tilt_gains_[i] = static_cast<float>(std::pow(10.0, tilt_db * 0.1));
+            }
+            tilt_gains_[0] = tilt_gains_[1];
+            updateWeights();
+        }
+
+        /**
+         * map the squared magnitude spectra onto the display grid
+         * @param output the tilted power spectrum on the display grid
+         * @param spectra the squared magnitude spectrum of the low, middle and high resolution
+         */
+        void process(const std::span<float> output,
+                     const std::array<std::span<const float>, kNumSources> spectra) const {
+            assert(output.size() == frequencies_.size());
+            for (size_t s = 0; s < kNumSources; ++s) {
+                assert(spectra[s].size() == spectrum_sizes_[s]);
+            }
+            for (const auto& segment : segments_) {
+                if (segment.source_b < kNumSources) {
+                    processSegment<true>(output.data(), segment,
+                                         spectra[segment.source_a].data(), spectra[segment.source_b].data());
+                } else {
+                    processSegment<false>(output.data(), segment,
+                                          spectra[segment.source_a].data(), nullptr);
+                }
+            }
+        }
+
+    private:
+        struct Segment {
+            size_t begin, end;
+            size_t source_a, source_b;
+        };
+
+        std::array<size_t, kNumSources> spectrum_sizes_{};
+        std::array<float, kNumSources> scales_{1.f, 1.f, 1.f};
+        std::vector<Segment> segments_;
+        std::vector<float> frequencies_;
+        // per output point: crossfade mix and interpolation position in each source
+        std::vector<float> mix_, frac_a_, frac_b_;
+        vector::aligned_vector<int32_t> idx_a_, idx_b_;
+        // per output point: final weights of the four source bins
+        vector::aligned_vector<float> w_a0_, w_a1_, w_b0_, w_b1_;
+        vector::aligned_vector<float> tilt_gains_;
+
+        /**
+         * mirror SpectrumBlender::sampleAtFrequency, the last bin is encoded as a full weight on idx + 1
+         */
+        static void locateBin(const size_t spectrum_size, const float frequency, const double sample_rate,
+                              int32_t& idx, float& frac) {
+            const auto fft_size = static_cast<double>((spectrum_size - 1) * 2);
+            const auto bin = std::clamp(static_cast<double>(frequency) * fft_size / sample_rate,
+                                        0.0, static_cast<double>(spectrum_size - 1));
+            const auto lower = static_cast<size_t>(bin);
+            if (lower + 1 >= spectrum_size) {
+                idx = static_cast<int32_t>(spectrum_size - 2);
+                frac = 1.f;
+            } else {
+                idx = static_cast<int32_t>(lower);
+                frac = static_cast<float>(bin - static_cast<double>(lower));
+            }
+        }
+
+        void updateWeights() {
+            for (const auto& segment : segments_) {
+                const auto scale_a = scales_[segment.source_a];
+                const auto scale_b = segment.source_b < kNumSources ? scales_[segment.source_b] : 0.f;
+                for (size_t i = segment.begin; i < segment.end; ++i) {
+                    const auto gain_a = (1.f - mix_[i]) * scale_a * tilt_gains_[i];
+                    const auto gain_b = mix_[i] * scale_b * tilt_gains_[i];
+                    w_a0_[i] = gain_a * (1.f - frac_a_[i]);
+                    w_a1_[i] = gain_a * frac_a_[i];
+                    w_b0_[i] = gain_b * (1.f - frac_b_[i]);
+                    w_b1_[i] = gain_b * frac_b_[i];
+                }
+            }
+        }
+
+        template <bool crossfade>
+        void processSegment(float* HWY_RESTRICT output, const Segment& segment,
+                            const float* HWY_RESTRICT source_a, const float* HWY_RESTRICT source_b) const {
+            static constexpr hn::ScalableTag<float> d;
+            static constexpr hn::RebindToSigned<decltype(d)> di;
+            static constexpr size_t lanes = hn::MaxLanes(d);
+            const auto v_one = hn::Set(di, 1);
+            size_t i = segment.begin;
+            for (; i + lanes <= segment.end; i += lanes) {
+                const auto v_idx_a = hn::LoadU(di, idx_a_.data() + i);
+                auto v_out = hn::Mul(hn::GatherIndex(d, source_a, v_idx_a), hn::LoadU(d, w_a0_.data() + i));
+                v_out = hn::MulAdd(hn::GatherIndex(d, source_a, hn::Add(v_idx_a, v_one)),
+                                   hn::LoadU(d, w_a1_.data() + i), v_out);
+                if constexpr (crossfade) {
+                    const auto v_idx_b = hn::LoadU(di, idx_b_.data() + i);
+                    v_out = hn::MulAdd(hn::GatherIndex(d, source_b, v_idx_b),
+                                       hn::LoadU(d, w_b0_.data() + i), v_out);
+                    v_out = hn::MulAdd(hn::GatherIndex(d, source_b, hn::Add(v_idx_b, v_one)),
+                                       hn::LoadU(d, w_b1_.data() + i), v_out);
+                }
+                hn::StoreU(v_out, d, output + i);
+            }
+            for (; i < segment.end; ++i) {
+                const auto ia = static_cast<size_t>(idx_a_[i]);
+                auto out = source_a[ia] * w_a0_[i] + source_a[ia + 1] * w_a1_[i];
+                if constexpr (crossfade) {
+                    const auto ib = static_cast<size_t>(idx_b_[i]);
+                    out += source_b[ib] * w_b0_[i] + source_b[ib + 1] * w_b1_[i];
+                }
+                output[i] = out;
+            }
+        }
+    };
+}
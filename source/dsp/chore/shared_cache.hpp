@@ -0,0 +1,50 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace zldsp::chore {
+    /**
+     * a process-wide cache of immutable values keyed by their parameters
+     * a value lives as long as any owner holds it, and it is created again once all owners have released it
+     * get() locks a mutex and may allocate, so it must not be called on the audio thread
+     * @tparam Key a key with operator<
+     * @tparam Value
+     */
+    template <typename Key, typename Value>
+    class SharedCache {
+    public:
+        /**
+         * get the value of the key, create it with the factory if no one holds it
+         * @param key
+         * @param factory a function which returns the value
+         * @return
+         */
+        template <typename Factory>
+        std::shared_ptr<const Value> get(const Key& key, Factory&& factory) {
+            const std::lock_guard<std::mutex> lock{mutex_};
+            std::erase_if(values_, [](const auto& pair) { return pair.second.expired(); });
+            auto& weak_value{values_[key]};
+            if (auto value = weak_value.lock()) {
+                return value;
+            }
+            auto value = std::make_shared<const Value>(factory());
+            weak_value = value;
+            return value;
+        }
+
+    private:
+        std::mutex mutex_;
+        std::map<Key, std::weak_ptr<const Value>> values_;
+    };
+}
@@ -11,6 +11,7 @@
 
 #include <cmath>
 #include <algorithm>
+#include <cstddef>
 
 namespace zldsp::chore {
     enum SmoothedTypes {
@@ -74,6 +75,35 @@ namespace zldsp::chore {
 
         [[nodiscard]] bool isSmoothing() const { return count_ > 0; }
 
+        /**
+         * get the increment of the next value, only for kFixLin
+         * the i-th next value is getCurrent() + i * getIncrement(), clamped at the target
+         */
+        FloatType getIncrement() const {
+            static_assert(kSmoothedType == kFixLin);
+            if (count_ == 0) { return FloatType(0); }
+            return is_increasing_ ? increase_inc_ : decrease_inc_;
+        }
+
+        /**
+         * skip the next num values
+         * @param num
+         */
+        void skip(const size_t num) {
+            if (count_ == 0 || num == 0) { return; }
+            if constexpr (kSmoothedType == kFixLin) {
+                current_ += static_cast<FloatType>(num) * (is_increasing_ ? increase_inc_ : decrease_inc_);
+                if (is_increasing_ ? current_ > target_ : current_ < target_) {
+                    current_ = target_;
+                    count_ = 0;
+                }
+            } else {
+                for (size_t i = 0; i < num && count_ > 0; ++i) {
+                    getNext();
+                }
+            }
+        }
+
         FloatType getNext() {
             if (count_ == 0) { return current_; }
             if constexpr (kSmoothedType == kLin) {
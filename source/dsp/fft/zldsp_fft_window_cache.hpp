@@ -0,0 +1,54 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <compare>
+#include "zldsp_fft_window.hpp"
+#include "../chore/shared_cache.hpp"
+#include "../vector/vector.hpp"
+
+namespace zldsp::fft {
+    enum class WindowType {
+        kHanning,
+        kHanningSqr
+    };
+
+    using SharedWindow = std::shared_ptr<const vector::aligned_vector<float>>;
+
+    /**
+     * get a scaled periodic window which is shared by all instances in the process
+     * @param size the window size
+     * @param type kHanning for scale * w, kHanningSqr for scale * w^2
+     * @param scale
+     * @return
+     */
+    inline SharedWindow getSharedWindow(const size_t size, const WindowType type, const float scale) {
+        struct Key {
+            size_t size;
+            WindowType type;
+            float scale;
+
+            auto operator<=>(const Key&) const = default;
+        };
+        static chore::SharedCache<Key, vector::aligned_vector<float>> cache;
+        return cache.get(Key{size, type, scale}, [&]() {
+            vector::aligned_vector<float> window(size);
+            if (type == WindowType::kHanning) {
+                createPeriodicHanning<float>(window, scale);
+            } else {
+                createPeriodicHanning<float>(window);
+                for (auto& x : window) {
+                    x = scale * x * x;
+                }
+            }
+            return window;
+        });
+    }
+}
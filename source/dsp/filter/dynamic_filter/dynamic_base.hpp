@@ -9,6 +9,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <type_traits>
+
 #include "dynamic_side_handler.hpp"
 
 namespace zldsp::filter {
@@ -56,9 +59,30 @@ namespace zldsp::filter {
             return filter_;
         }
 
+        /**
+         * set the control interval of the dynamic gain
+         * if the interval is larger than 1, the dynamic gain is sampled every control_interval samples
+         * and the coefficients are linearly interpolated in between
+         * the coefficients agree with the per-sample path at each control point, but the output does not:
+         * the filter state evolves under the interpolated coefficients, so the output deviates by a small
+         * bounded amount (see tests/dynamic_control_rate_test.cpp)
+         * @param control_interval
+         */
+        void setControlInterval(const size_t control_interval) {
+            control_interval_ = std::max(control_interval, static_cast<size_t>(1));
+        }
+
+        [[nodiscard]] size_t getControlInterval() const {
+            return control_interval_;
+        }
+
     protected:
+        using CoeffArray = std::remove_cvref_t<decltype(std::declval<FilterType&>().getCoeff())>;
+
         FilterType filter_{};
         zldsp::filter::DynamicSideHandler<FloatType>& handler_;
+        size_t control_interval_{1};
+        CoeffArray start_coeffs_{}, end_coeffs_{}, delta_coeffs_{};
 
         /**
          * process the incoming audio buffer
@@ -121,6 +145,12 @@ namespace zldsp::filter {
         template <int order, bool bypass = false, bool dynamic_bypass = false>
         void internalProcess(std::span<FloatType*> main_buffer, std::span<FloatType*> side_buffer,
                              const size_t num_samples) {
+            if constexpr (!dynamic_bypass) {
+                if (control_interval_ > 1) {
+                    internalControlProcess<order, bypass>(main_buffer, side_buffer, num_samples);
+                    return;
+                }
+            }
             const auto side_p = side_buffer[0];
             // dynamic processing
             for (size_t i = 0; i < num_samples; ++i) {
@@ -136,5 +166,58 @@ namespace zldsp::filter {
                 }
             }
         }
+
+        /**
+         * process the incoming audio buffer with control-rate dynamic gain
+         * the coefficients are designed at the end of each control block and linearly interpolated from
+         * the previous ones, hence the per-sample cost is several additions instead of a redesign
+         * @param main_buffer
+         * @param side_buffer
+         * @param num_samples
+         */
+        template <int order, bool bypass = false>
+        void internalControlProcess(std::span<FloatType*> main_buffer, std::span<FloatType*> side_buffer,
+                                    const size_t num_samples) {
+            const auto side_p = side_buffer[0];
+            auto& coeffs{filter_.getCoeff()};
+            const auto filter_num = filter_.getFilterNum();
+            size_t i = 0;
+            while (i < num_samples) {
+                const auto block_size = std::min(control_interval_, num_samples - i);
+                // design the coefficients at the end of the control block
+                std::copy(coeffs.begin(), coeffs.begin() + filter_num, start_coeffs_.begin());
+                filter_.updateGainLinear(side_p[i + block_size - 1]);
+                std::copy(coeffs.begin(), coeffs.begin() + filter_num, end_coeffs_.begin());
+                const auto block_size_inverse = 1.0 / static_cast<double>(block_size);
+                for (size_t filter_idx = 0; filter_idx < filter_num; ++filter_idx) {
+                    for (size_t k = 0; k < 5; ++k) {
+                        delta_coeffs_[filter_idx][k] = (end_coeffs_[filter_idx][k] - start_coeffs_[filter_idx][k])
+                            * block_size_inverse;
+                    }
+                }
+                std::copy(start_coeffs_.begin(), start_coeffs_.begin() + filter_num, coeffs.begin());
+                // interpolate the coefficients, the last sample uses the exact designed coefficients
+                const auto block_end = i + block_size;
+                for (; i < block_end; ++i) {
+                    if (i + 1 == block_end) {
+                        std::copy(end_coeffs_.begin(), end_coeffs_.begin() + filter_num, coeffs.begin());
+                    } else {
+                        for (size_t filter_idx = 0; filter_idx < filter_num; ++filter_idx) {
+                            for (size_t k = 0; k < 5; ++k) {
+                                coeffs[filter_idx][k] += delta_coeffs_[filter_idx][k];
+                            }
+                        }
+                    }
+                    for (size_t chan = 0; chan < main_buffer.size(); ++chan) {
+                        if constexpr (bypass) {
+                            filter_.template processSample<order>(chan, main_buffer[chan][i]);
+                        } else {
+                            main_buffer[chan][i] = filter_.template processSample<order>(
+                                chan, main_buffer[chan][i]);
+                        }
+                    }
+                }
+            }
+        }
     };
 }
@@ -121,6 +121,34 @@ namespace zldsp::filter {
         void internalDynamicProcess(std::span<FloatType*> side_buffer, const size_t num_samples) {
             const auto parallel_buffer = this->filter_.getParallelBuffer();
             const auto side_p = side_buffer[0];
+            if constexpr (!dynamic_bypass) {
+                if (this->control_interval_ > 1) {
+                    // only the multiplier depends on the dynamic gain, interpolate it between control points
+                    size_t i = 0;
+                    while (i < num_samples) {
+                        const auto block_size = std::min(this->control_interval_, num_samples - i);
+                        const auto start_multiplier = this->filter_.getMultiplier();
+                        this->filter_.updateGainLinear(side_p[i + block_size - 1]);
+                        const auto end_multiplier = this->filter_.getMultiplier();
+                        const auto delta_multiplier = (end_multiplier - start_multiplier)
+                            / static_cast<FloatType>(block_size);
+                        auto multiplier = start_multiplier;
+                        const auto block_end = i + block_size;
+                        for (; i < block_end; ++i) {
+                            multiplier = (i + 1 == block_end) ? end_multiplier : multiplier + delta_multiplier;
+                            for (size_t chan = 0; chan < parallel_buffer.size(); ++chan) {
+                                if constexpr (bypass) {
+                                    this->filter_.template processSample<order>(chan, parallel_buffer[chan][i]);
+                                } else {
+                                    parallel_buffer[chan][i] = this->filter_.template processSample<order>(
+                                        chan, parallel_buffer[chan][i]) * multiplier;
+                                }
+                            }
+                        }
+                    }
+                    return;
+                }
+            }
             // dynamic processing
             for (size_t i = 0; i < num_samples; ++i) {
                 if constexpr (!dynamic_bypass) {
@@ -41,6 +41,40 @@ namespace zldsp::filter::FilterDesign {
         return 9;
     }
 
+    /**
+     * coefficient classes which can design all stages of a cascade at once
+     */
+    template <class Coeff>
+    concept HasCascadeDesign = requires(std::span<const double> values,
+                                        std::span<std::array<double, 5>> coeffs,
+                                        std::span<std::array<double, 3>> first_order_coeffs) {
+        Coeff::get2Cascade(kPeak, 0.0, 0.0, values, coeffs);
+        Coeff::get1HighShelves(values, 0.0, first_order_coeffs);
+    };
+
+    static constexpr size_t kMaxCascadeNum = 16;
+
+    /**
+     * calculate the Q value of each stage of a cascade
+     * q_i = 0.5 / cos(theta0 * (2i + 1)) * scale * 2 ^ (centered_i * rescale_base)
+     * @param n the order of the cascade
+     * @param q0 the Q value of the cascade
+     * @param qs where the Q value of each stage will be written, its size should be n / 2
+     */
+    inline void getCascadeQs(const size_t n, const double q0, std::span<double> qs) {
+        const size_t number = n / 2;
+        const auto theta0 = pi / static_cast<double>(number) / 4;
+        const auto scale = std::pow(std::sqrt(2.0) * q0, 1 / static_cast<double>(number));
+        const auto rescale_base = std::log10(std::sqrt(2.0) * q0) / std::pow(static_cast<double>(n), 1.5) * 12;
+        // a scalar loop, so that the Q values do not depend on the SIMD width or the order
+        for (size_t i = 0; i < number; ++i) {
+            const auto centered = static_cast<double>(i) - static_cast<double>(number) / 2 + 0.5;
+            const auto rescale = centered * rescale_base;
+            const auto theta = theta0 * static_cast<double>(2 * i + 1);
+            qs[i] = 1.0 / 2.0 / std::cos(theta) * scale * std::pow(2, rescale);
+        }
+    }
+
     template <class Coeff>
     size_t updateFlatShelfCoeffs(const double freq, const double fs, const double g_dB,
                                  std::span<std::array<double, 5>> coeffs) {
@@ -59,6 +93,20 @@ namespace zldsp::filter::FilterDesign {
         const double makeup_gain = 1.0 / std::sqrt(total_mag_sq);
 
         const double inv_fs = 1.0 / fs;
+        if constexpr (HasCascadeDesign<Coeff>) {
+            std::array<double, flat_freq.size()> w0s{};
+            std::array<std::array<double, 3>, flat_freq.size()> first_order_coeffs{};
+            for (size_t i = 0; i < num_filters; ++i) {
+                w0s[i] = flat_freq[i] * inv_fs;
+            }
+            Coeff::get1HighShelves(std::span(w0s.data(), num_filters), g_shelf_dB,
+                                   std::span(first_order_coeffs.data(), num_filters));
+            for (size_t i = 0; i < num_filters - 1; ++i) {
+                coeffs[i] = Coeff::pack1stOrder(first_order_coeffs[i]);
+            }
+            coeffs[num_filters - 1] = Coeff::pack1stOrder(first_order_coeffs[num_filters - 1], makeup_gain);
+            return num_filters;
+        }
         for (size_t i = 0; i < num_filters - 1; ++i) {
             const double w_i = flat_freq[i] * inv_fs;
             const auto coeff = Coeff::get1HighShelf(w_i, g_shelf_dB);
@@ -111,22 +159,21 @@ namespace zldsp::filter::FilterDesign {
             return 1;
         }
         const size_t number = n / 2;
-        const auto theta0 = pi / static_cast<double>(number) / 4;
-        const auto scale = std::pow(std::sqrt(2.0) * q0, 1 / static_cast<double>(number));
-        const auto rescale_base = std::log10(std::sqrt(2.0) * q0) / std::pow(static_cast<double>(n), 1.5) * 12;
+        std::array<double, kMaxCascadeNum> qs{};
+        getCascadeQs(n, q0, std::span(qs.data(), number));
+        if constexpr (HasCascadeDesign<Coeff>) {
+            Coeff::get2Cascade(filter_type, w0, 0.0, std::span(qs.data(), number), coeffs.subspan(start_idx, number));
+            return number;
+        }
         for (size_t i = 0; i < number; i++) {
-            const auto centered = static_cast<double>(i) - static_cast<double>(number) / 2 + 0.5;
-            const auto rescale = centered * rescale_base;
-            const auto theta = theta0 * static_cast<double>(2 * i + 1);
-            const auto qs = 1.0 / 2.0 / std::cos(theta) * scale * std::pow(2, rescale);
             if constexpr (filter_type == kLowPass) {
-                coeffs[i + start_idx] = Coeff::get2LowPass(w0, qs);
+                coeffs[i + start_idx] = Coeff::get2LowPass(w0, qs[i]);
             }
             if constexpr (filter_type == kHighPass) {
-                coeffs[i + start_idx] = Coeff::get2HighPass(w0, qs);
+                coeffs[i + start_idx] = Coeff::get2HighPass(w0, qs[i]);
             }
             if constexpr (filter_type == kAllPass) {
-                coeffs[i + start_idx] = Coeff::get2AllPass(w0, qs);
+                coeffs[i + start_idx] = Coeff::get2AllPass(w0, qs[i]);
             }
         }
         return number;
@@ -164,22 +211,21 @@ namespace zldsp::filter::FilterDesign {
         }
         const size_t number = n / 2;
         const auto _g = g_dB / static_cast<double>(number);
-        const auto theta0 = pi / static_cast<double>(number) / 4;
-        const auto scale = std::pow(std::sqrt(2.0) * q0, 1 / static_cast<double>(number));
-        const auto rescale_base = std::log10(std::sqrt(2.0) * q0) / std::pow(static_cast<double>(n), 1.5) * 12;
+        std::array<double, kMaxCascadeNum> qs{};
+        getCascadeQs(n, q0, std::span(qs.data(), number));
+        if constexpr (HasCascadeDesign<Coeff>) {
+            Coeff::get2Cascade(filter_type, w0, _g, std::span(qs.data(), number), coeffs.subspan(start_idx, number));
+            return number;
+        }
         for (size_t i = 0; i < number; i++) {
-            const auto centered = static_cast<double>(i) - static_cast<double>(number) / 2 + 0.5;
-            const auto rescale = centered * rescale_base;
-            const auto theta = theta0 * static_cast<double>(2 * i + 1);
-            const auto _q = 1.0 / 2.0 / std::cos(theta) * scale * std::pow(2, rescale);
             if constexpr (filter_type == kLowShelf) {
-                coeffs[i + start_idx] = Coeff::get2LowShelf(w0, _g, _q);
+                coeffs[i + start_idx] = Coeff::get2LowShelf(w0, _g, qs[i]);
             }
             if constexpr (filter_type == kHighShelf) {
-                coeffs[i + start_idx] = Coeff::get2HighShelf(w0, _g, _q);
+                coeffs[i + start_idx] = Coeff::get2HighShelf(w0, _g, qs[i]);
             }
             if constexpr (filter_type == kTiltShelf) {
-                coeffs[i + start_idx] = Coeff::get2TiltShelf(w0, _g, _q);
+                coeffs[i + start_idx] = Coeff::get2TiltShelf(w0, _g, qs[i]);
             }
         }
         return number;
@@ -188,15 +234,10 @@ namespace zldsp::filter::FilterDesign {
     template <class Coeff>
     inline void updateShelfDynamicCache(const size_t n, const double w0, const double q0, double* cache) {
         const size_t number = n / 2;
-        const auto theta0 = pi / static_cast<double>(number) / 4;
-        const auto scale = std::pow(std::sqrt(2.0) * q0, 1 / static_cast<double>(number));
-        const auto rescale_base = std::log10(std::sqrt(2.0) * q0) / std::pow(static_cast<double>(n), 1.5) * 12;
+        std::array<double, kMaxCascadeNum> qs{};
+        getCascadeQs(n, q0, std::span(qs.data(), number));
         for (size_t i = 0; i < number; i++) {
-            const auto centered = static_cast<double>(i) - static_cast<double>(number) / 2 + 0.5;
-            const auto rescale = centered * rescale_base;
-            const auto theta = theta0 * static_cast<double>(2 * i + 1);
-            const auto _q = 1.0 / 2.0 / std::cos(theta) * scale * std::pow(2, rescale);
-            Coeff::update2ShelfDynamicCache(w0, _q, cache + (i * 3));
+            Coeff::update2ShelfDynamicCache(w0, qs[i], cache + (i * 3));
         }
     }
 
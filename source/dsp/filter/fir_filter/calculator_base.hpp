@@ -9,9 +9,11 @@
 
 #pragma once
 
+#include <utility>
+
 #include "../../vector/vector.hpp"
 #include "../iir_filter/tdf/tdf.hpp"
-#include "../ideal_filter/ideal.hpp"
+#include "../ideal_filter/ideal_batch.hpp"
 
 namespace zldsp::filter {
     template <size_t kFilterNum, size_t kFilterSize>
@@ -29,8 +31,11 @@ namespace zldsp::filter {
             w_biquad_imag_.resize(num_bin);
             zldsp::filter::TDFBase<float>::calculateWs(w_biquad_real_, w_biquad_imag_);
 
-            proto_real_.resize(num_bin);
-            proto_imag_.resize(num_bin);
+            for (size_t idx = 0; idx < kFilterSize; ++idx) {
+                stage_reals_[idx].resize(num_bin);
+                stage_imags_[idx].resize(num_bin);
+            }
+            proto_batch_.prepare(w_prototype_);
             biquad_real_.resize(num_bin);
             biquad_imag_.resize(num_bin);
 
@@ -47,27 +52,24 @@ namespace zldsp::filter {
                     std::array<Ideal<float, kFilterSize>, kFilterNum>& ideals,
                     const std::span<size_t> indices,
                     std::array<bool, kFilterNum>& update_flags) {
-            // update filter corrections
+            // update filter corrections, the proto responses of the stages of all updated bands are evaluated
+            // together, kFilterSize stages per pass
             for (const size_t& i : indices) {
                 if (!update_flags[i]) { continue; }
                 std::ranges::fill(corrections_real_[i], 1.f);
                 std::ranges::fill(corrections_imag_[i], 0.f);
-                auto& ideal{ideals[i]};
-                auto& tdf{tdfs[i]};
-                const auto filter_num = ideal.getFilterNum();
-                for (size_t idx = 0; idx < filter_num; ++idx) {
-                    // update proto response
-                    const auto proto_coeff = ideal.getCoeff()[idx];
-                    IdealBase<float>::updateResponse(proto_coeff, w_prototype_,
-                                                     proto_real_, proto_imag_);
-                    // update biquad response
-                    const auto biquad_coeff = tdf.getCoeff()[idx];
-                    TDFBase<float>::updateResponse(biquad_coeff, w_biquad_real_, w_biquad_imag_,
-                                                   biquad_real_, biquad_imag_);
-                    // update correction
-                    updateCorrection(i);
+                const auto proto_coeffs = ideals[i].getActiveCoeffs();
+                for (size_t idx = 0; idx < proto_coeffs.size(); ++idx) {
+                    if (num_pending_ == kFilterSize) {
+                        flushPending(tdfs);
+                    }
+                    proto_batch_.addResponse(proto_coeffs.subspan(idx, 1),
+                                             stage_reals_[num_pending_], stage_imags_[num_pending_]);
+                    pending_stages_[num_pending_] = {i, idx};
+                    num_pending_ += 1;
                 }
             }
+            flushPending(tdfs);
         }
 
         std::array<vector::aligned_vector<float>, kFilterNum>& getCorrectionsReal() {
@@ -84,7 +86,13 @@ namespace zldsp::filter {
         vector::aligned_vector<float> w_prototype_;
         vector::aligned_vector<float> w_biquad_real_, w_biquad_imag_;
 
-        vector::aligned_vector<float> proto_real_, proto_imag_;
+        // the proto response of the stage which is being corrected
+        std::span<float> proto_real_, proto_imag_;
+        // the proto responses of the stages which wait for the next pass of the batch, with their band and stage
+        std::array<vector::aligned_vector<float>, kFilterSize> stage_reals_{}, stage_imags_{};
+        std::array<std::pair<size_t, size_t>, kFilterSize> pending_stages_{};
+        size_t num_pending_{0};
+        IdealBatch<float, kFilterSize, kFilterSize> proto_batch_;
         vector::aligned_vector<float> biquad_real_, biquad_imag_;
 
         std::array<vector::aligned_vector<float>, kFilterNum> corrections_real_{};
@@ -93,5 +101,27 @@ namespace zldsp::filter {
         virtual void prepareCorrection(size_t num_bin) = 0;
 
         virtual void updateCorrection(size_t idx) = 0;
+
+        /**
+         * evaluate the pending proto responses and apply the corrections of their stages in order
+         */
+        void flushPending(std::array<TDF<float, kFilterSize>, kFilterNum>& tdfs) {
+            if (num_pending_ == 0) {
+                return;
+            }
+            proto_batch_.process();
+            proto_batch_.clear();
+            for (size_t k = 0; k < num_pending_; ++k) {
+                const auto [band, idx] = pending_stages_[k];
+                proto_real_ = stage_reals_[k];
+                proto_imag_ = stage_imags_[k];
+                // update biquad response
+                TDFBase<float>::updateResponse(tdfs[band].getCoeff()[idx], w_biquad_real_, w_biquad_imag_,
+                                               biquad_real_, biquad_imag_);
+                // update correction
+                updateCorrection(band);
+            }
+            num_pending_ = 0;
+        }
     };
 }
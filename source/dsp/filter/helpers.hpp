@@ -36,6 +36,8 @@ namespace zldsp::filter {
         FilterType filter_type;
         size_t order;
         double freq, gain, q;
+
+        bool operator==(const FilterParameters&) const = default;
     };
 
     inline double dotProduct(const std::array<double, 3>& x, const std::array<double, 3>& y) {
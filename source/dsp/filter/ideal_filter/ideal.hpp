@@ -111,6 +111,10 @@ namespace zldsp::filter {
             return coeffs_;
         }
 
+        [[nodiscard]] std::span<const std::array<double, 5>> getActiveCoeffs() const {
+            return {coeffs_.data(), current_filter_num_};
+        }
+
         [[nodiscard]] FilterParameters getParas() const {
             return FilterParameters{getFilterType(), getOrder(), getFreq(), getGain(), getQ()};
         }
@@ -0,0 +1,147 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <span>
+
+#include "ideal.hpp"
+#include "ideal_batch_kernel.hpp"
+#include "../../vector/vector.hpp"
+
+namespace zldsp::filter {
+    /**
+     * entry points of the batch kernel, compiled for every Highway target in ideal_batch_dispatch.cpp
+     * with ZL_HWY_DYNAMIC_DISPATCH, otherwise the static kernel is inlined
+     */
+    namespace dispatch {
+        void processIdealBatch(const float* ws, const float* w2s, size_t size,
+                               const IdealBatchStage<float>* stages,
+                               const IdealBatchJob<float>* jobs, size_t num_jobs);
+        void processIdealBatch(const double* ws, const double* w2s, size_t size,
+                               const IdealBatchStage<double>* stages,
+                               const IdealBatchJob<double>* jobs, size_t num_jobs);
+    }
+
+    /**
+     * evaluate the responses of many cascaded prototype filters on one frequency grid in a single pass
+     * each grid chunk (and its squared frequency) is loaded once and shared by all added filters
+     * the capacity is fixed so that it can be used on the audio thread
+     * @tparam FloatType
+     * @tparam kMaxStages the maximum number of second-order stages over all added filters
+     * @tparam kMaxJobs the maximum number of added filters
+     */
+    template <typename FloatType, size_t kMaxStages, size_t kMaxJobs>
+    class IdealBatch {
+    public:
+        IdealBatch() = default;
+
+        /**
+         * set the frequency grid, call it again when the values of the grid change
+         * the grid must outlive the batch
+         * @param ws
+         */
+        void prepare(std::span<const FloatType> ws) {
+            ws_ = ws;
+            w2s_.resize(ws.size());
+            for (size_t i = 0; i < ws.size(); ++i) {
+                w2s_[i] = ws[i] * ws[i];
+            }
+            clear();
+        }
+
+        [[nodiscard]] size_t size() const {
+            return ws_.size();
+        }
+
+        /**
+         * remove all added filters
+         */
+        void clear() {
+            num_stages_ = 0;
+            num_jobs_ = 0;
+        }
+
+        /**
+         * add a magnitude square job, the coeffs are copied so the filter can change before process()
+         * @param coeffs the active stages of the filter
+         * @param res_mag_sqr where the magnitude square response will be written
+         */
+        void addMagnitudeSquare(std::span<const std::array<double, 5>> coeffs,
+                                std::span<FloatType> res_mag_sqr) {
+            assert(res_mag_sqr.size() >= ws_.size());
+            addJob(coeffs, true, res_mag_sqr.data(), nullptr);
+        }
+
+        template <size_t kFilterSize>
+        void addMagnitudeSquare(const Ideal<FloatType, kFilterSize>& ideal,
+                                std::span<FloatType> res_mag_sqr) {
+            addMagnitudeSquare(ideal.getActiveCoeffs(), res_mag_sqr);
+        }
+
+        /**
+         * add a complex response job, the coeffs are copied so the filter can change before process()
+         * @param coeffs the stages of the filter
+         * @param res_real where the real part of the response will be written
+         * @param res_imag where the imaginary part of the response will be written
+         */
+        void addResponse(std::span<const std::array<double, 5>> coeffs,
+                         std::span<FloatType> res_real, std::span<FloatType> res_imag) {
+            assert(res_real.size() >= ws_.size() && res_imag.size() >= ws_.size());
+            addJob(coeffs, false, res_real.data(), res_imag.data());
+        }
+
+        /**
+         * evaluate all added jobs
+         */
+        void process() const {
+            if constexpr (vector::kIsDispatched<FloatType>) {
+                dispatch::processIdealBatch(ws_.data(), w2s_.data(), ws_.size(),
+                                            stages_.data(), jobs_.data(), num_jobs_);
+            } else {
+                HWY_NAMESPACE::processIdealBatch(ws_.data(), w2s_.data(), ws_.size(),
+                                                 stages_.data(), jobs_.data(), num_jobs_);
+            }
+        }
+
+    private:
+        using Stage = IdealBatchStage<FloatType>;
+        using Job = IdealBatchJob<FloatType>;
+
+        std::span<const FloatType> ws_{};
+        vector::aligned_vector<FloatType> w2s_{};
+        std::array<Stage, kMaxStages> stages_{};
+        std::array<Job, kMaxJobs> jobs_{};
+        size_t num_stages_{0}, num_jobs_{0};
+
+        void addJob(std::span<const std::array<double, 5>> coeffs, const bool is_magnitude,
+                    FloatType* out0, FloatType* out1) {
+            assert(num_jobs_ < kMaxJobs && num_stages_ + coeffs.size() <= kMaxStages);
+            auto& job = jobs_[num_jobs_];
+            job.stage_start = num_stages_;
+            for (const auto& coeff : coeffs) {
+                auto& stage = stages_[num_stages_];
+                stage.a1 = static_cast<FloatType>(is_magnitude ? coeff[0] * coeff[0] : coeff[0]);
+                stage.a0 = static_cast<FloatType>(coeff[1]);
+                stage.b2 = static_cast<FloatType>(coeff[2]);
+                stage.b1 = static_cast<FloatType>(is_magnitude ? coeff[3] * coeff[3] : coeff[3]);
+                stage.b0 = static_cast<FloatType>(coeff[4]);
+                num_stages_ += 1;
+            }
+            job.stage_end = num_stages_;
+            job.is_magnitude = is_magnitude;
+            job.out0 = out0;
+            job.out1 = out1;
+            num_jobs_ += 1;
+        }
+    };
+}
@@ -0,0 +1,58 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+#undef HWY_TARGET_INCLUDE
+#define HWY_TARGET_INCLUDE "dsp/filter/ideal_filter/ideal_batch_dispatch.cpp"
+#include <hwy/foreach_target.h>
+#include <hwy/highway.h>
+
+#include "ideal_batch_kernel.hpp"
+
+HWY_BEFORE_NAMESPACE();
+
+namespace zldsp::filter::HWY_NAMESPACE {
+    void ProcessIdealBatchF32(const float* HWY_RESTRICT ws, const float* HWY_RESTRICT w2s, const size_t size,
+                              const IdealBatchStage<float>* HWY_RESTRICT stages,
+                              const IdealBatchJob<float>* HWY_RESTRICT jobs, const size_t num_jobs) {
+        processIdealBatch(ws, w2s, size, stages, jobs, num_jobs);
+    }
+
+    void ProcessIdealBatchF64(const double* HWY_RESTRICT ws, const double* HWY_RESTRICT w2s, const size_t size,
+                              const IdealBatchStage<double>* HWY_RESTRICT stages,
+                              const IdealBatchJob<double>* HWY_RESTRICT jobs, const size_t num_jobs) {
+        processIdealBatch(ws, w2s, size, stages, jobs, num_jobs);
+    }
+}
+
+HWY_AFTER_NAMESPACE();
+
+#if HWY_ONCE
+
+#include "ideal_batch.hpp"
+
+namespace zldsp::filter {
+    HWY_EXPORT(ProcessIdealBatchF32);
+    HWY_EXPORT(ProcessIdealBatchF64);
+
+    namespace dispatch {
+        void processIdealBatch(const float* ws, const float* w2s, const size_t size,
+                               const IdealBatchStage<float>* stages,
+                               const IdealBatchJob<float>* jobs, const size_t num_jobs) {
+            HWY_DYNAMIC_DISPATCH(ProcessIdealBatchF32)(ws, w2s, size, stages, jobs, num_jobs);
+        }
+
+        void processIdealBatch(const double* ws, const double* w2s, const size_t size,
+                               const IdealBatchStage<double>* stages,
+                               const IdealBatchJob<double>* jobs, const size_t num_jobs) {
+            HWY_DYNAMIC_DISPATCH(ProcessIdealBatchF64)(ws, w2s, size, stages, jobs, num_jobs);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,144 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef ZLDSP_IDEAL_BATCH_TYPES_HPP_
+#define ZLDSP_IDEAL_BATCH_TYPES_HPP_
+
+#include <cstddef>
+
+namespace zldsp::filter {
+    /**
+     * stage coefficients of IdealBatch, a1 and b1 are squared for magnitude jobs
+     */
+    template <typename FloatType>
+    struct IdealBatchStage {
+        FloatType a1, a0, b2, b1, b0;
+    };
+
+    template <typename FloatType>
+    struct IdealBatchJob {
+        size_t stage_start, stage_end;
+        bool is_magnitude;
+        FloatType* out0;
+        FloatType* out1;
+    };
+}
+
+#endif
+
+// per-target header, it is included once for each Highway target by ideal_batch_dispatch.cpp
+#if defined(ZLDSP_IDEAL_BATCH_KERNEL_HPP_) == defined(HWY_TARGET_TOGGLE)
+#ifdef ZLDSP_IDEAL_BATCH_KERNEL_HPP_
+#undef ZLDSP_IDEAL_BATCH_KERNEL_HPP_
+#else
+#define ZLDSP_IDEAL_BATCH_KERNEL_HPP_
+#endif
+
+#include "../../vector/highway_import.hpp"
+
+HWY_BEFORE_NAMESPACE();
+
+namespace zldsp::filter::HWY_NAMESPACE {
+    namespace hn = hwy::HWY_NAMESPACE;
+
+    /**
+     * evaluate the jobs of IdealBatch on the grid
+     * @param ws the frequency grid
+     * @param w2s the squared frequency grid, aligned
+     * @param size the size of the grid
+     * @param stages
+     * @param jobs
+     * @param num_jobs
+     */
+    template <typename F>
+    HWY_INLINE void processIdealBatch(const F* HWY_RESTRICT ws, const F* HWY_RESTRICT w2s, const size_t size,
+                                      const IdealBatchStage<F>* HWY_RESTRICT stages,
+                                      const IdealBatchJob<F>* HWY_RESTRICT jobs, const size_t num_jobs) {
+        static constexpr hn::ScalableTag<F> d;
+        static constexpr size_t lanes = hn::MaxLanes(d);
+
+        const auto v_one = hn::Set(d, F(1));
+        size_t i = 0;
+        for (; i + lanes <= size; i += lanes) {
+            const auto w = hn::LoadU(d, ws + i);
+            const auto w2 = hn::Load(d, w2s + i);
+            for (size_t j = 0; j < num_jobs; ++j) {
+                const auto& job = jobs[j];
+                if (job.is_magnitude) {
+                    auto mag_sq = v_one;
+                    for (size_t s = job.stage_start; s < job.stage_end; ++s) {
+                        const auto& c = stages[s];
+                        const auto t1 = hn::Sub(hn::Set(d, c.a0), w2);
+                        const auto den = hn::MulAdd(hn::Set(d, c.a1), w2, hn::Mul(t1, t1));
+                        const auto t2 = hn::NegMulAdd(hn::Set(d, c.b2), w2, hn::Set(d, c.b0));
+                        const auto num = hn::MulAdd(hn::Set(d, c.b1), w2, hn::Mul(t2, t2));
+                        mag_sq = hn::Mul(mag_sq, hn::Div(num, den));
+                    }
+                    hn::StoreU(mag_sq, d, job.out0 + i);
+                } else {
+                    auto rr = v_one;
+                    auto ri = hn::Zero(d);
+                    for (size_t s = job.stage_start; s < job.stage_end; ++s) {
+                        const auto& c = stages[s];
+                        const auto nr = hn::NegMulAdd(hn::Set(d, c.b2), w2, hn::Set(d, c.b0));
+                        const auto ni = hn::Mul(hn::Set(d, c.b1), w);
+                        const auto dr = hn::Sub(hn::Set(d, c.a0), w2);
+                        const auto di = hn::Mul(hn::Set(d, c.a1), w);
+                        const auto den = hn::MulAdd(dr, dr, hn::Mul(di, di));
+                        const auto hr = hn::Div(hn::MulAdd(nr, dr, hn::Mul(ni, di)), den);
+                        const auto hi = hn::Div(hn::MulSub(ni, dr, hn::Mul(nr, di)), den);
+                        const auto new_rr = hn::MulSub(rr, hr, hn::Mul(ri, hi));
+                        ri = hn::MulAdd(rr, hi, hn::Mul(ri, hr));
+                        rr = new_rr;
+                    }
+                    hn::StoreU(rr, d, job.out0 + i);
+                    hn::StoreU(ri, d, job.out1 + i);
+                }
+            }
+        }
+        for (; i < size; ++i) {
+            const auto w = ws[i];
+            const auto w2 = w2s[i];
+            for (size_t j = 0; j < num_jobs; ++j) {
+                const auto& job = jobs[j];
+                if (job.is_magnitude) {
+                    F mag_sq{1};
+                    for (size_t s = job.stage_start; s < job.stage_end; ++s) {
+                        const auto& c = stages[s];
+                        const auto t1 = c.a0 - w2;
+                        const auto t2 = c.b0 - c.b2 * w2;
+                        mag_sq *= (c.b1 * w2 + t2 * t2) / (c.a1 * w2 + t1 * t1);
+                    }
+                    job.out0[i] = mag_sq;
+                } else {
+                    F rr{1}, ri{0};
+                    for (size_t s = job.stage_start; s < job.stage_end; ++s) {
+                        const auto& c = stages[s];
+                        const auto nr = c.b0 - c.b2 * w2;
+                        const auto ni = c.b1 * w;
+                        const auto dr = c.a0 - w2;
+                        const auto di = c.a1 * w;
+                        const auto den = dr * dr + di * di;
+                        const auto hr = (nr * dr + ni * di) / den;
+                        const auto hi = (ni * dr - nr * di) / den;
+                        const auto new_rr = rr * hr - ri * hi;
+                        ri = rr * hi + ri * hr;
+                        rr = new_rr;
+                    }
+                    job.out0[i] = rr;
+                    job.out1[i] = ri;
+                }
+            }
+        }
+    }
+}
+
+HWY_AFTER_NAMESPACE();
+
+#endif
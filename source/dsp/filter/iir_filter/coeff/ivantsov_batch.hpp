@@ -0,0 +1,165 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <span>
+#include "../../../vector/highway_import.hpp"
+#include "../../filter_design/filter_design.hpp"
+#include "ivantsov_constants.hpp"
+
+/**
+ * structure-of-arrays kernels of the Ivantsov designs
+ * they evaluate the same formulas as the scalar helpers in ivantsov_coeff.cpp and ivantsov_svf_coeff.cpp
+ * for many stages at once, results agree with the scalar path within the accuracy of hwy/contrib/math
+ * every stage runs through the vector code, the remainder is padded, so a stage never depends on its position
+ */
+namespace zldsp::filter::ivantsov_batch {
+    namespace hn = hwy::HWY_NAMESPACE;
+
+    using FilterDesign::kMaxCascadeNum;
+    using ivantsov::kPi;
+    using ivantsov::kPiSq;
+    using ivantsov::kSigmaSq;
+    using ivantsov::kSigma4;
+    using ivantsov::kSplineWA;
+    using ivantsov::kSplineWB;
+    using ivantsov::kSplineInvDelta;
+    using ivantsov::kSplineA;
+    using ivantsov::kSplineB;
+    using ivantsov::kSplineC;
+    using ivantsov::kSplineD;
+
+    /**
+     * the pre-warped squared frequency of each normalized frequency w0
+     */
+    inline void getWrappingW2(const double* HWY_RESTRICT w0s, double* HWY_RESTRICT w2s, const size_t size) {
+        static constexpr hn::ScalableTag<double> d;
+        static constexpr size_t lanes = hn::MaxLanes(d);
+        const auto v_pi = hn::Set(d, kPi);
+        const auto v_pi_sq = hn::Set(d, kPiSq);
+        const auto v_sigma_sq = hn::Set(d, kSigmaSq);
+        const auto v_one = hn::Set(d, 1.0);
+        const auto compute = [&](const auto w0) {
+            // tan(pi * w0)^2 = sin^2 / cos^2
+            const auto x = hn::Mul(v_pi, w0);
+            const auto sin_val = hn::Sin(d, x);
+            const auto cos_val = hn::Cos(d, x);
+            const auto tan_w2 = hn::MulAdd(v_pi_sq, hn::Div(hn::Mul(cos_val, cos_val), hn::Mul(sin_val, sin_val)),
+                                           v_sigma_sq);
+            const auto t = hn::Mul(hn::Sub(w0, hn::Set(d, kSplineWA)), hn::Set(d, kSplineInvDelta));
+            auto spline_w2 = hn::MulAdd(hn::Set(d, kSplineA), t, hn::Set(d, kSplineB));
+            spline_w2 = hn::MulAdd(spline_w2, t, hn::Set(d, kSplineC));
+            spline_w2 = hn::MulAdd(spline_w2, t, hn::Set(d, kSplineD));
+            const auto inv_w2 = hn::Div(v_one, hn::Mul(w0, w0));
+            const auto w2 = hn::IfThenElse(hn::Ge(w0, hn::Set(d, kSplineWB)), inv_w2, spline_w2);
+            return hn::IfThenElse(hn::Le(w0, hn::Set(d, kSplineWA)), tan_w2, w2);
+        };
+        size_t i = 0;
+        for (; i + lanes <= size; i += lanes) {
+            hn::StoreU(compute(hn::LoadU(d, w0s + i)), d, w2s + i);
+        }
+        if (i < size) {
+            // the remainder goes through the same vector code, padded with a harmless frequency
+            HWY_ALIGN std::array<double, lanes> tail;
+            tail.fill(0.25);
+            std::copy(w0s + i, w0s + size, tail.begin());
+            hn::Store(compute(hn::Load(d, tail.data())), d, tail.data());
+            std::copy_n(tail.begin(), size - i, w2s + i);
+        }
+    }
+
+    /**
+     * the first-order pole/zero position of each squared frequency
+     */
+    inline void getPhi(const double* HWY_RESTRICT w2s, double* HWY_RESTRICT phis, const size_t size) {
+        static constexpr hn::ScalableTag<double> d;
+        static constexpr size_t lanes = hn::MaxLanes(d);
+        const auto v_pi = hn::Set(d, kPi);
+        const auto v_sigma_sq = hn::Set(d, kSigmaSq);
+        const auto compute = [&](const auto w2) {
+            const auto root = hn::Sqrt(hn::Add(w2, v_sigma_sq));
+            return hn::Div(hn::Sub(v_pi, root), hn::Add(v_pi, root));
+        };
+        size_t i = 0;
+        for (; i + lanes <= size; i += lanes) {
+            hn::StoreU(compute(hn::LoadU(d, w2s + i)), d, phis + i);
+        }
+        if (i < size) {
+            HWY_ALIGN std::array<double, lanes> tail;
+            tail.fill(1.0);
+            std::copy(w2s + i, w2s + size, tail.begin());
+            hn::Store(compute(hn::Load(d, tail.data())), d, tail.data());
+            std::copy_n(tail.begin(), size - i, phis + i);
+        }
+    }
+
+    /**
+     * the second-order core (v, d and pi * sqrt(2 * (v + kappa))) of each squared frequency and damping
+     */
+    inline void getCore(const double* HWY_RESTRICT w2s, const double* HWY_RESTRICT zeta2s,
+                        double* HWY_RESTRICT vs, double* HWY_RESTRICT ds, double* HWY_RESTRICT pi_sq_terms,
+                        const size_t size) {
+        static constexpr hn::ScalableTag<double> d;
+        static constexpr size_t lanes = hn::MaxLanes(d);
+        const auto v_pi = hn::Set(d, kPi);
+        const auto v_pi_sq = hn::Set(d, kPiSq);
+        const auto v_sigma_sq = hn::Set(d, kSigmaSq);
+        const auto v_two_sigma_sq = hn::Set(d, 2.0 * kSigmaSq);
+        const auto v_sigma4 = hn::Set(d, kSigma4);
+        const auto v_one = hn::Set(d, 1.0);
+        const auto v_two = hn::Set(d, 2.0);
+        const auto compute = [&](const double* HWY_RESTRICT w2_ptr, const double* HWY_RESTRICT zeta2_ptr,
+                                 double* HWY_RESTRICT v_ptr, double* HWY_RESTRICT d_ptr,
+                                 double* HWY_RESTRICT pi_sq_term_ptr) {
+            const auto w2 = hn::LoadU(d, w2_ptr);
+            const auto z_term = hn::MulSub(v_two, hn::LoadU(d, zeta2_ptr), v_one);
+            const auto w2_z = hn::Mul(w2, z_term);
+            const auto kappa = hn::Add(w2_z, v_sigma_sq);
+            const auto v = hn::Sqrt(hn::Abs(hn::MulAdd(w2, w2, hn::MulAdd(v_two_sigma_sq, w2_z, v_sigma4))));
+            const auto pi_sq_term = hn::Mul(v_pi, hn::Sqrt(hn::Abs(hn::Mul(v_two, hn::Add(v, kappa)))));
+            hn::StoreU(v, d, v_ptr);
+            hn::StoreU(hn::Add(hn::Add(v_pi_sq, pi_sq_term), v), d, d_ptr);
+            hn::StoreU(pi_sq_term, d, pi_sq_term_ptr);
+        };
+        size_t i = 0;
+        for (; i + lanes <= size; i += lanes) {
+            compute(w2s + i, zeta2s + i, vs + i, ds + i, pi_sq_terms + i);
+        }
+        if (i < size) {
+            HWY_ALIGN std::array<double, lanes> w2_tail, zeta2_tail, v_tail, d_tail, pi_sq_term_tail;
+            w2_tail.fill(1.0);
+            zeta2_tail.fill(0.5);
+            std::copy(w2s + i, w2s + size, w2_tail.begin());
+            std::copy(zeta2s + i, zeta2s + size, zeta2_tail.begin());
+            compute(w2_tail.data(), zeta2_tail.data(), v_tail.data(), d_tail.data(), pi_sq_term_tail.data());
+            std::copy_n(v_tail.begin(), size - i, vs + i);
+            std::copy_n(d_tail.begin(), size - i, ds + i);
+            std::copy_n(pi_sq_term_tail.begin(), size - i, pi_sq_terms + i);
+        }
+    }
+
+    /**
+     * the cores of a cascade whose stages share one squared frequency but have individual Q values
+     */
+    struct CascadeCore {
+        std::array<double, kMaxCascadeNum> w2s{}, zeta2s{}, vs{}, ds{}, pi_sq_terms{};
+
+        void compute(const double w2, const std::span<const double> qs) {
+            for (size_t i = 0; i < qs.size(); ++i) {
+                w2s[i] = w2;
+                zeta2s[i] = 1.0 / (4.0 * qs[i] * qs[i]);
+            }
+            getCore(w2s.data(), zeta2s.data(), vs.data(), ds.data(), pi_sq_terms.data(), qs.size());
+        }
+    };
+}
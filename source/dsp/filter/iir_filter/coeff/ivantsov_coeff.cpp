@@ -9,29 +9,19 @@
 
 #include "ivantsov_coeff.hpp"
 #include <cmath>
+#include <cassert>
 #include <algorithm>
 
+#include "ivantsov_batch.hpp"
+#include "ivantsov_constants.hpp"
+
 namespace zldsp::filter {
     namespace {
-        constexpr double kPi = 3.14159265358979323846;
-        constexpr double kSigma = 2.00143;
+        using namespace ivantsov;
 
-        constexpr double kPiSq = kPi * kPi;
         constexpr double kTwoPiSq = 2.0 * kPiSq;
         constexpr double kFourPiSq = 4.0 * kPiSq;
 
-        constexpr double kSigmaSq = kSigma * kSigma;
-        constexpr double kSigma4 = kSigmaSq * kSigmaSq;
-
-        constexpr double kSplineWA = 0.4996419767299294;
-        constexpr double kSplineWB = 0.5919981009;
-        constexpr double kSplineInvDelta = 10.8276522968691715;
-        constexpr double kSplineA = 1.4079737347730696;
-        constexpr double kSplineB = -2.5538880428234330;
-        constexpr double kSplineC = -0.0064417990487326;
-        constexpr double kSplineD = 4.0057345308722958;
-
-        constexpr double kPhi0 = (kPi - kSigma) / (kPi + kSigma);
         constexpr double kLpA1 = 2.0 * kPhi0;
         constexpr double kLpA2 = kPhi0 * kPhi0;
         constexpr double kLpGScalar = 1.0 / (1.0 + kLpA1 + kLpA2);
@@ -41,26 +31,10 @@ namespace zldsp::filter {
         constexpr double kBpGDenom = kPi * (1.0 + kPhi0);
         constexpr double kBpGMultiplier = kFourPiSq / kBpGDenom;
 
-        constexpr double kDbToExp2 = 0.16609640474436813;
-        constexpr double kDbToExp2Sqrt = kDbToExp2 * 0.5;
-
         struct PhiPair {
             double p1, p2, d;
         };
 
-        inline double get_wrapping_w2(const double w0) {
-            if (w0 <= kSplineWA) {
-                const auto pi_fc_fs = kPi * w0;
-                const auto tan_val = std::tan(pi_fc_fs);
-                return kSigmaSq + kPiSq / (tan_val * tan_val);
-            } else if (w0 >= kSplineWB) {
-                return 1.0 / (w0 * w0);
-            } else {
-                const double t = (w0 - kSplineWA) * kSplineInvDelta;
-                return t * (t * (kSplineA * t + kSplineB) + kSplineC) + kSplineD;
-            }
-        }
-
         inline double get_phi(const double w2) {
             const auto root = std::sqrt(w2 + kSigmaSq);
             return (kPi - root) / (kPi + root);
@@ -79,6 +53,12 @@ namespace zldsp::filter {
             return {(kTwoPiSq - 2.0 * v) * d_inv, (kPiSq - pi_sq_term + v) * d_inv, d};
         }
 
+        inline PhiPair get_phi_sq(const ivantsov_batch::CascadeCore& core, const size_t i) {
+            const auto v = core.vs[i];
+            const auto d_inv = 1.0 / core.ds[i];
+            return {(kTwoPiSq - 2.0 * v) * d_inv, (kPiSq - core.pi_sq_terms[i] + v) * d_inv, core.ds[i]};
+        }
+
         inline PhiPair get_phi_notch_sq(const double w2) {
             const auto kappa = kSigmaSq - w2;
             const auto v = std::abs(w2 - kSigmaSq);
@@ -117,27 +97,27 @@ namespace zldsp::filter {
     }
 
     std::array<double, 3> IvantsovCoeff::get1LowPass(const double w0) {
-        const auto w2 = get_wrapping_w2(w0);
+        const auto w2 = getWrappingW2(w0);
         const auto beta = get_phi(w2);
         const auto factor = (1.0 / (1.0 + kPhi0)) * (1.0 + beta);
         return {beta, factor, factor * kPhi0};
     }
 
     std::array<double, 3> IvantsovCoeff::get1HighPass(const double w0) {
-        const auto w2 = get_wrapping_w2(w0);
-        const auto beta = get_phi(get_wrapping_w2(w0));
+        const auto w2 = getWrappingW2(w0);
+        const auto beta = get_phi(getWrappingW2(w0));
         const auto factor = (std::sqrt(w2) / (2.0 * kPi)) * (1.0 + beta);
         return {beta, factor, -factor};
     }
 
     std::array<double, 3> IvantsovCoeff::get1AllPass(const double w0) {
-        const auto w2 = get_wrapping_w2(w0);
+        const auto w2 = getWrappingW2(w0);
         const auto beta = get_phi(w2);
         return {beta, beta, 1.0};
     }
 
     std::array<double, 3> IvantsovCoeff::get1LowShelf(const double w0, const double g) {
-        const auto w2 = get_wrapping_w2(w0);
+        const auto w2 = getWrappingW2(w0);
         const auto g_linear = std::exp2(g * kDbToExp2);
 
         const auto alpha = get_phi(w2 / g_linear);
@@ -147,7 +127,7 @@ namespace zldsp::filter {
     }
 
     std::array<double, 3> IvantsovCoeff::get1HighShelf(const double w0, const double g) {
-        const auto w2 = get_wrapping_w2(w0);
+        const auto w2 = getWrappingW2(w0);
         const auto g_linear = std::exp2(g * kDbToExp2);
 
         const auto alpha = get_phi(w2 * g_linear);
@@ -157,7 +137,7 @@ namespace zldsp::filter {
     }
 
     std::array<double, 3> IvantsovCoeff::get1TiltShelf(const double w0, const double g) {
-        const auto w2 = get_wrapping_w2(w0);
+        const auto w2 = getWrappingW2(w0);
         const auto g_half = std::exp2(g * kDbToExp2Sqrt);
         const auto g_linear = g_half * g_half;
 
@@ -168,7 +148,7 @@ namespace zldsp::filter {
     }
 
     void IvantsovCoeff::update1ShelfDynamicCache(const double w0, double* cache) {
-        cache[0] = get_wrapping_w2(w0);
+        cache[0] = getWrappingW2(w0);
     }
 
     std::array<double, 3> IvantsovCoeff::get1LowShelfWithCache(const double g_linear_sqrt, const double* cache) {
@@ -203,21 +183,21 @@ namespace zldsp::filter {
     }
 
     std::array<double, 5> IvantsovCoeff::get2LowPass(const double w0, const double q) {
-        const auto w2 = get_wrapping_w2(w0);
+        const auto w2 = getWrappingW2(w0);
         const auto phi = get_phi_sq(w2, 1.0 / (4.0 * q * q));
         const auto factor = kLpGScalar * (1.0 + phi.p1 + phi.p2);
         return {phi.p1, phi.p2, factor, factor * kLpA1, factor * kLpA2};
     }
 
     std::array<double, 5> IvantsovCoeff::get2HighPass(const double w0, const double q) {
-        const auto w2 = get_wrapping_w2(w0);
+        const auto w2 = getWrappingW2(w0);
         const auto phi = get_phi_sq(w2, 1.0 / (4.0 * q * q));
         const auto factor = w2 / phi.d;
         return {phi.p1, phi.p2, factor, factor * -2.0, factor};
     }
 
     std::array<double, 5> IvantsovCoeff::get2BandPass(const double w0, const double q) {
-        const auto w2 = get_wrapping_w2(w0);
+        const auto w2 = getWrappingW2(w0);
         const auto zeta = 1.0 / (2.0 * q);
         const auto phi = get_phi_sq(w2, zeta * zeta);
         const auto factor = (std::sqrt(w2) * zeta * kBpGMultiplier) / phi.d;
@@ -225,13 +205,13 @@ namespace zldsp::filter {
     }
 
     std::array<double, 5> IvantsovCoeff::get2AllPass(const double w0, const double q) {
-        const auto w2 = get_wrapping_w2(w0);
+        const auto w2 = getWrappingW2(w0);
         const auto phi = get_phi_sq(w2, 1.0 / (4.0 * q * q));
         return {phi.p1, phi.p2, phi.p2, phi.p1, 1.0};
     }
 
     std::array<double, 5> IvantsovCoeff::get2Notch(const double w0, const double q) {
-        const auto w2 = get_wrapping_w2(w0);
+        const auto w2 = getWrappingW2(w0);
         const auto alpha = get_phi_notch_sq(w2);
         const auto beta = get_phi_sq(w2, 1.0 / (4.0 * q * q));
         const auto factor = alpha.d / beta.d;
@@ -239,7 +219,7 @@ namespace zldsp::filter {
     }
 
     std::array<double, 5> IvantsovCoeff::get2Peak(const double w0, const double g, const double q) {
-        const auto w2 = get_wrapping_w2(w0);
+        const auto w2 = getWrappingW2(w0);
         const auto zeta2 = 1.0 / (4.0 * q * q);
         const auto g_linear = std::exp2(g * kDbToExp2);
         const auto alpha = get_phi_sq(w2, zeta2 * g_linear);
@@ -249,7 +229,7 @@ namespace zldsp::filter {
     }
 
     std::array<double, 5> IvantsovCoeff::get2LowShelf(const double w0, const double g, const double q) {
-        const auto w2 = get_wrapping_w2(w0);
+        const auto w2 = getWrappingW2(w0);
         const auto zeta2 = 1.0 / (4.0 * q * q);
         const auto g_half = std::exp2(g * kDbToExp2Sqrt);
         const auto alpha = get_phi_sq(w2 / g_half, zeta2);
@@ -259,7 +239,7 @@ namespace zldsp::filter {
     }
 
     std::array<double, 5> IvantsovCoeff::get2HighShelf(const double w0, const double g, const double q) {
-        const auto w2 = get_wrapping_w2(w0);
+        const auto w2 = getWrappingW2(w0);
         const auto zeta2 = 1.0 / (4.0 * q * q);
         const auto g_half = std::exp2(g * kDbToExp2Sqrt);
         const auto alpha = get_phi_sq(w2 * g_half, zeta2);
@@ -269,7 +249,7 @@ namespace zldsp::filter {
     }
 
     std::array<double, 5> IvantsovCoeff::get2TiltShelf(const double w0, const double g, const double q) {
-        const auto w2 = get_wrapping_w2(w0);
+        const auto w2 = getWrappingW2(w0);
         const auto zeta2 = 1.0 / (4.0 * q * q);
         const auto g_half = std::exp2(g * kDbToExp2Sqrt);
         const auto inv_g_half = 1.0 / g_half;
@@ -280,7 +260,7 @@ namespace zldsp::filter {
     }
 
     void IvantsovCoeff::update2PeakDynamicCache(const double w0, const double q, double* cache) {
-        const auto w2 = get_wrapping_w2(w0);
+        const auto w2 = getWrappingW2(w0);
         const auto zeta2 = 1.0 / (4.0 * q * q);
         cache[0] = 2.0 * w2 * zeta2;
         cache[1] = kSigmaSq - w2;
@@ -297,7 +277,7 @@ namespace zldsp::filter {
     }
 
     void IvantsovCoeff::update2ShelfDynamicCache(const double w0, const double q, double* cache) {
-        const auto w2 = get_wrapping_w2(w0);
+        const auto w2 = getWrappingW2(w0);
         const auto zeta2 = 1.0 / (4.0 * q * q);
         cache[0] = w2 * (2.0 * zeta2 - 1.0);
         cache[1] = w2 * w2;
@@ -329,4 +309,96 @@ namespace zldsp::filter {
         const auto factor = inv_g_linear_sqrt * (alpha.d / beta.d);
         return {beta.p1, beta.p2, factor, factor * alpha.p1, factor * alpha.p2};
     }
+
+    void IvantsovCoeff::get2Cascade(const FilterType filter_type, const double w0, const double g,
+                                    const std::span<const double> qs,
+                                    const std::span<std::array<double, 5>> coeffs) {
+        assert(qs.size() <= FilterDesign::kMaxCascadeNum && coeffs.size() >= qs.size());
+        const auto w2 = getWrappingW2(w0);
+        const auto g_half = std::exp2(g * kDbToExp2Sqrt);
+        const auto inv_g_half = 1.0 / g_half;
+        ivantsov_batch::CascadeCore alpha, beta;
+        switch (filter_type) {
+        case kLowPass:
+        case kHighPass:
+        case kAllPass: {
+            beta.compute(w2, qs);
+            break;
+        }
+        case kLowShelf: {
+            alpha.compute(w2 / g_half, qs);
+            beta.compute(w2 * g_half, qs);
+            break;
+        }
+        case kHighShelf:
+        case kTiltShelf: {
+            alpha.compute(w2 * g_half, qs);
+            beta.compute(w2 * inv_g_half, qs);
+            break;
+        }
+        case kPeak:
+        case kNotch:
+        case kBandPass:
+        case kFlatTilt:
+        case kFlatGain:
+        default:
+            return;
+        }
+        for (size_t i = 0; i < qs.size(); ++i) {
+            const auto b = get_phi_sq(beta, i);
+            switch (filter_type) {
+            case kLowPass: {
+                const auto factor = kLpGScalar * (1.0 + b.p1 + b.p2);
+                coeffs[i] = {b.p1, b.p2, factor, factor * kLpA1, factor * kLpA2};
+                break;
+            }
+            case kHighPass: {
+                const auto factor = w2 / b.d;
+                coeffs[i] = {b.p1, b.p2, factor, factor * -2.0, factor};
+                break;
+            }
+            case kAllPass: {
+                coeffs[i] = {b.p1, b.p2, b.p2, b.p1, 1.0};
+                break;
+            }
+            case kLowShelf:
+            case kHighShelf:
+            case kTiltShelf: {
+                const auto a = get_phi_sq(alpha, i);
+                const auto scale = filter_type == kLowShelf
+                                       ? g_half * g_half
+                                       : (filter_type == kTiltShelf ? inv_g_half : 1.0);
+                const auto factor = scale * (a.d / b.d);
+                coeffs[i] = {b.p1, b.p2, factor, factor * a.p1, factor * a.p2};
+                break;
+            }
+            case kPeak:
+            case kNotch:
+            case kBandPass:
+            case kFlatTilt:
+            case kFlatGain:
+            default:
+                break;
+            }
+        }
+    }
+
+    void IvantsovCoeff::get1HighShelves(const std::span<const double> w0s, const double g,
+                                        const std::span<std::array<double, 3>> coeffs) {
+        assert(w0s.size() <= FilterDesign::kMaxCascadeNum && coeffs.size() >= w0s.size());
+        const auto size = w0s.size();
+        const auto g_linear = std::exp2(g * kDbToExp2);
+        std::array<double, FilterDesign::kMaxCascadeNum> w2s{}, alpha_w2s{}, beta_w2s{}, alphas{}, betas{};
+        ivantsov_batch::getWrappingW2(w0s.data(), w2s.data(), size);
+        for (size_t i = 0; i < size; ++i) {
+            alpha_w2s[i] = w2s[i] * g_linear;
+            beta_w2s[i] = w2s[i] / g_linear;
+        }
+        ivantsov_batch::getPhi(alpha_w2s.data(), alphas.data(), size);
+        ivantsov_batch::getPhi(beta_w2s.data(), betas.data(), size);
+        for (size_t i = 0; i < size; ++i) {
+            const auto factor = (1.0 / (1.0 + alphas[i])) * (1.0 + betas[i]);
+            coeffs[i] = {betas[i], factor, factor * alphas[i]};
+        }
+    }
 }
@@ -0,0 +1,50 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <cmath>
+
+/**
+ * constants and the frequency pre-warping shared by the Ivantsov TDF/SVF designs and their batch kernels
+ */
+namespace zldsp::filter::ivantsov {
+    inline constexpr double kPi = 3.14159265358979323846;
+    inline constexpr double kSigma = 2.00143;
+
+    inline constexpr double kPiSq = kPi * kPi;
+    inline constexpr double kSigmaSq = kSigma * kSigma;
+    inline constexpr double kSigma4 = kSigmaSq * kSigmaSq;
+
+    inline constexpr double kSplineWA = 0.4996419767299294;
+    inline constexpr double kSplineWB = 0.5919981009;
+    inline constexpr double kSplineInvDelta = 10.8276522968691715;
+    inline constexpr double kSplineA = 1.4079737347730696;
+    inline constexpr double kSplineB = -2.5538880428234330;
+    inline constexpr double kSplineC = -0.0064417990487326;
+    inline constexpr double kSplineD = 4.0057345308722958;
+
+    inline constexpr double kPhi0 = (kPi - kSigma) / (kPi + kSigma);
+
+    /**
+     * the pre-warped squared frequency of a normalized frequency w0
+     * tan-based below kSplineWA, 1 / w0^2 above kSplineWB and a cubic spline in between
+     */
+    inline double getWrappingW2(const double w0) {
+        if (w0 <= kSplineWA) {
+            const auto tan_val = std::tan(kPi * w0);
+            return kSigmaSq + kPiSq / (tan_val * tan_val);
+        } else if (w0 >= kSplineWB) {
+            return 1.0 / (w0 * w0);
+        } else {
+            const double t = (w0 - kSplineWA) * kSplineInvDelta;
+            return t * (t * (kSplineA * t + kSplineB) + kSplineC) + kSplineD;
+        }
+    }
+}
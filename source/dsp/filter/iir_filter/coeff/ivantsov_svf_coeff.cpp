@@ -9,32 +9,21 @@
 
 #include "ivantsov_svf_coeff.hpp"
 #include <cmath>
+#include <cassert>
 #include <algorithm>
 
+#include "ivantsov_batch.hpp"
+#include "ivantsov_constants.hpp"
+
 namespace zldsp::filter {
     namespace {
-        constexpr double kPi = 3.14159265358979323846;
-        constexpr double kSigma = 2.00143;
+        using namespace ivantsov;
 
-        constexpr double kPiSq = kPi * kPi;
         constexpr double kTwoPiSq = 2.0 * kPiSq;
         constexpr double kFourPiSq = 4.0 * kPiSq;
         constexpr double kInvTwoPiSq = 1.0 / kTwoPiSq;
         constexpr double kInvPi = 1.0 / kPi;
 
-        constexpr double kSigmaSq = kSigma * kSigma;
-        constexpr double kSigma4 = kSigmaSq * kSigmaSq;
-
-        constexpr double kSplineWA = 0.4996419767299294;
-        constexpr double kSplineWB = 0.5919981009;
-        constexpr double kSplineInvDelta = 10.8276522968691715;
-        constexpr double kSplineA = 1.4079737347730696;
-        constexpr double kSplineB = -2.5538880428234330;
-        constexpr double kSplineC = -0.0064417990487326;
-        constexpr double kSplineD = 4.0057345308722958;
-
-        constexpr double kPhi0 = (kPi - kSigma) / (kPi + kSigma);
-
         constexpr double kInvTwoPi = 0.5 / kPi;
         constexpr double kLpC0 = 1.0 / (1.0 + kPhi0);
 
@@ -48,22 +37,6 @@ namespace zldsp::filter {
         constexpr double kBpC0Numerator = kBpGMultiplier / (2.0 * kPiSq);
         constexpr double kBpC3Numerator = (kBpGMultiplier * (1.0 - kPhi0)) / (2.0 * kPi);
 
-        constexpr double kDbToExp2 = 0.16609640474436813;
-        constexpr double kDbToExp2Sqrt = kDbToExp2 * 0.5;
-
-        inline double get_wrapping_w2(const double w0) {
-            if (w0 <= kSplineWA) {
-                const auto pi_fc_fs = kPi * w0;
-                const auto tan_val = std::tan(pi_fc_fs);
-                return kSigmaSq + kPiSq / (tan_val * tan_val);
-            } else if (w0 >= kSplineWB) {
-                return 1.0 / (w0 * w0);
-            } else {
-                const double t = (w0 - kSplineWA) * kSplineInvDelta;
-                return t * (t * (kSplineA * t + kSplineB) + kSplineC) + kSplineD;
-            }
-        }
-
         inline double get_phi(const double w2) {
             const auto root = std::sqrt(w2 + kSigmaSq);
             return (kPi - root) / (kPi + root);
@@ -85,6 +58,10 @@ namespace zldsp::filter {
             return {v, d, pi_sq_term};
         }
 
+        inline PhaseCore get_svf_core(const ivantsov_batch::CascadeCore& core, const size_t i) {
+            return {core.vs[i], core.ds[i], core.pi_sq_terms[i]};
+        }
+
         inline PhaseCore get_svf_notch_core(const double w2) {
             const auto kappa = kSigmaSq - w2;
             const auto v = std::abs(w2 - kSigmaSq);
@@ -114,14 +91,14 @@ namespace zldsp::filter {
     }
 
     std::array<double, 3> IvantsovSVFCoeff::get1LowPass(const double w0) {
-        const auto w2 = get_wrapping_w2(w0);
+        const auto w2 = getWrappingW2(w0);
         const auto beta = get_phi(w2);
 
         return {kLpC0, 1.0 + beta, 1.0};
     }
 
     std::array<double, 3> IvantsovSVFCoeff::get1HighPass(const double w0) {
-        const auto w2 = get_wrapping_w2(w0);
+        const auto w2 = getWrappingW2(w0);
         const auto beta = get_phi(w2);
 
         const auto c0 = std::sqrt(w2) * kInvTwoPi;
@@ -130,7 +107,7 @@ namespace zldsp::filter {
     }
 
     std::array<double, 3> IvantsovSVFCoeff::get1AllPass(const double w0) {
-        const auto w2 = get_wrapping_w2(w0);
+        const auto w2 = getWrappingW2(w0);
         const auto beta = get_phi(w2);
 
         const auto c1 = 1.0 + beta;
@@ -139,7 +116,7 @@ namespace zldsp::filter {
     }
 
     std::array<double, 3> IvantsovSVFCoeff::get1LowShelf(const double w0, const double g) {
-        const auto w2 = get_wrapping_w2(w0);
+        const auto w2 = getWrappingW2(w0);
         const auto g_linear = std::exp2(g * kDbToExp2);
 
         const auto alpha = get_phi(w2 / g_linear);
@@ -151,7 +128,7 @@ namespace zldsp::filter {
     }
 
     std::array<double, 3> IvantsovSVFCoeff::get1HighShelf(const double w0, const double g) {
-        const auto w2 = get_wrapping_w2(w0);
+        const auto w2 = getWrappingW2(w0);
         const auto g_linear = std::exp2(g * kDbToExp2);
 
         const auto alpha = get_phi(w2 * g_linear);
@@ -163,7 +140,7 @@ namespace zldsp::filter {
     }
 
     std::array<double, 3> IvantsovSVFCoeff::get1TiltShelf(const double w0, const double g) {
-        const auto w2 = get_wrapping_w2(w0);
+        const auto w2 = getWrappingW2(w0);
         const auto g_half = std::exp2(g * kDbToExp2Sqrt);
         const auto g_linear = g_half * g_half;
         const auto inv_g_half = 1.0 / g_half;
@@ -177,7 +154,7 @@ namespace zldsp::filter {
     }
 
     void IvantsovSVFCoeff::update1ShelfDynamicCache(const double w0, double* cache) {
-        cache[0] = get_wrapping_w2(w0);
+        cache[0] = getWrappingW2(w0);
     }
 
     std::array<double, 3> IvantsovSVFCoeff::get1LowShelfWithCache(const double g_linear_sqrt, const double* cache) {
@@ -219,7 +196,7 @@ namespace zldsp::filter {
     }
 
     std::array<double, 5> IvantsovSVFCoeff::get2LowPass(const double w0, const double q) {
-        const auto w2 = get_wrapping_w2(w0);
+        const auto w2 = getWrappingW2(w0);
         const auto core = get_svf_core(w2, 1.0 / (4.0 * q * q));
 
         const double v_sqrt = std::sqrt(core.v);
@@ -232,7 +209,7 @@ namespace zldsp::filter {
     }
 
     std::array<double, 5> IvantsovSVFCoeff::get2HighPass(const double w0, const double q) {
-        const auto w2 = get_wrapping_w2(w0);
+        const auto w2 = getWrappingW2(w0);
         const auto core = get_svf_core(w2, 1.0 / (4.0 * q * q));
 
         const double v_sqrt = std::sqrt(core.v);
@@ -246,7 +223,7 @@ namespace zldsp::filter {
     }
 
     std::array<double, 5> IvantsovSVFCoeff::get2BandPass(const double w0, const double q) {
-        const auto w2 = get_wrapping_w2(w0);
+        const auto w2 = getWrappingW2(w0);
         const auto zeta = 1.0 / (2.0 * q);
         const auto core = get_svf_core(w2, zeta * zeta);
 
@@ -262,7 +239,7 @@ namespace zldsp::filter {
     }
 
     std::array<double, 5> IvantsovSVFCoeff::get2AllPass(const double w0, const double q) {
-        const auto w2 = get_wrapping_w2(w0);
+        const auto w2 = getWrappingW2(w0);
         const auto core = get_svf_core(w2, 1.0 / (4.0 * q * q));
 
         const double v_sqrt = std::sqrt(core.v);
@@ -275,7 +252,7 @@ namespace zldsp::filter {
     }
 
     std::array<double, 5> IvantsovSVFCoeff::get2Notch(const double w0, const double q) {
-        const auto w2 = get_wrapping_w2(w0);
+        const auto w2 = getWrappingW2(w0);
         const auto alpha = get_svf_notch_core(w2);
         const auto beta = get_svf_core(w2, 1.0 / (4.0 * q * q));
 
@@ -290,7 +267,7 @@ namespace zldsp::filter {
     }
 
     std::array<double, 5> IvantsovSVFCoeff::get2Peak(const double w0, const double g, const double q) {
-        const auto w2 = get_wrapping_w2(w0);
+        const auto w2 = getWrappingW2(w0);
         const auto zeta2 = 1.0 / (4.0 * q * q);
         const auto g_linear = std::exp2(g * kDbToExp2);
 
@@ -308,7 +285,7 @@ namespace zldsp::filter {
     }
 
     std::array<double, 5> IvantsovSVFCoeff::get2LowShelf(const double w0, const double g, const double q) {
-        const auto w2 = get_wrapping_w2(w0);
+        const auto w2 = getWrappingW2(w0);
         const auto zeta2 = 1.0 / (4.0 * q * q);
         const auto g_half = std::exp2(g * kDbToExp2Sqrt);
 
@@ -328,7 +305,7 @@ namespace zldsp::filter {
     }
 
     std::array<double, 5> IvantsovSVFCoeff::get2HighShelf(const double w0, const double g, const double q) {
-        const auto w2 = get_wrapping_w2(w0);
+        const auto w2 = getWrappingW2(w0);
         const auto zeta2 = 1.0 / (4.0 * q * q);
         const auto g_half = std::exp2(g * kDbToExp2Sqrt);
 
@@ -346,7 +323,7 @@ namespace zldsp::filter {
     }
 
     std::array<double, 5> IvantsovSVFCoeff::get2TiltShelf(const double w0, const double g, const double q) {
-        const auto w2 = get_wrapping_w2(w0);
+        const auto w2 = getWrappingW2(w0);
         const auto zeta2 = 1.0 / (4.0 * q * q);
         const auto g_half = std::exp2(g * kDbToExp2Sqrt);
         const auto inv_g_half = 1.0 / g_half;
@@ -366,7 +343,7 @@ namespace zldsp::filter {
     }
 
     void IvantsovSVFCoeff::update2PeakDynamicCache(const double w0, const double q, double* cache) {
-        const auto w2 = get_wrapping_w2(w0);
+        const auto w2 = getWrappingW2(w0);
         const auto zeta2 = 1.0 / (4.0 * q * q);
         cache[0] = 2.0 * w2 * zeta2;
         cache[1] = kSigmaSq - w2;
@@ -390,7 +367,7 @@ namespace zldsp::filter {
     }
 
     void IvantsovSVFCoeff::update2ShelfDynamicCache(const double w0, const double q, double* cache) {
-        const auto w2 = get_wrapping_w2(w0);
+        const auto w2 = getWrappingW2(w0);
         const auto zeta2 = 1.0 / (4.0 * q * q);
         cache[0] = w2 * (2.0 * zeta2 - 1.0);
         cache[1] = w2 * w2;
@@ -441,4 +418,95 @@ namespace zldsp::filter {
 
         return {c0, c1, c2, c3, c4};
     }
+
+    void IvantsovSVFCoeff::get2Cascade(const FilterType filter_type, const double w0, const double g,
+                                       const std::span<const double> qs,
+                                       const std::span<std::array<double, 5>> coeffs) {
+        assert(qs.size() <= FilterDesign::kMaxCascadeNum && coeffs.size() >= qs.size());
+        const auto w2 = getWrappingW2(w0);
+        const auto g_half = std::exp2(g * kDbToExp2Sqrt);
+        const auto inv_g_half = 1.0 / g_half;
+        ivantsov_batch::CascadeCore alpha, beta;
+        switch (filter_type) {
+        case kLowPass:
+        case kHighPass:
+        case kAllPass: {
+            beta.compute(w2, qs);
+            break;
+        }
+        case kLowShelf: {
+            alpha.compute(w2 / g_half, qs);
+            beta.compute(w2 * g_half, qs);
+            break;
+        }
+        case kHighShelf:
+        case kTiltShelf: {
+            alpha.compute(w2 * g_half, qs);
+            beta.compute(w2 * inv_g_half, qs);
+            break;
+        }
+        case kPeak:
+        case kNotch:
+        case kBandPass:
+        case kFlatTilt:
+        case kFlatGain:
+        default:
+            return;
+        }
+        for (size_t i = 0; i < qs.size(); ++i) {
+            const auto b = get_svf_core(beta, i);
+            const double v_sqrt = std::sqrt(b.v);
+            const double c1 = kTwoPiSq / b.d;
+            const double c2 = v_sqrt * kInvPi;
+            switch (filter_type) {
+            case kLowPass: {
+                coeffs[i] = {2.0 * kLpGScalar, c1, c2, kLpC3Numerator / v_sqrt, 1.0};
+                break;
+            }
+            case kHighPass: {
+                coeffs[i] = {w2 * kInvTwoPiSq, c1, c2, w2 / (kPi * v_sqrt), 0.0};
+                break;
+            }
+            case kAllPass: {
+                coeffs[i] = {(kPiSq - b.pi_sq_term + b.v) * kInvTwoPiSq, c1, c2, c2, 1.0};
+                break;
+            }
+            case kLowShelf:
+            case kHighShelf:
+            case kTiltShelf: {
+                const auto a = get_svf_core(alpha, i);
+                const auto scale = filter_type == kLowShelf
+                                       ? g_half * g_half
+                                       : (filter_type == kTiltShelf ? inv_g_half : 1.0);
+                coeffs[i] = {scale * a.d * kInvTwoPiSq, c1, c2, scale * a.v / (kPi * v_sqrt), scale};
+                break;
+            }
+            case kPeak:
+            case kNotch:
+            case kBandPass:
+            case kFlatTilt:
+            case kFlatGain:
+            default:
+                break;
+            }
+        }
+    }
+
+    void IvantsovSVFCoeff::get1HighShelves(const std::span<const double> w0s, const double g,
+                                           const std::span<std::array<double, 3>> coeffs) {
+        assert(w0s.size() <= FilterDesign::kMaxCascadeNum && coeffs.size() >= w0s.size());
+        const auto size = w0s.size();
+        const auto g_linear = std::exp2(g * kDbToExp2);
+        std::array<double, FilterDesign::kMaxCascadeNum> w2s{}, alpha_w2s{}, beta_w2s{}, alphas{}, betas{};
+        ivantsov_batch::getWrappingW2(w0s.data(), w2s.data(), size);
+        for (size_t i = 0; i < size; ++i) {
+            alpha_w2s[i] = w2s[i] * g_linear;
+            beta_w2s[i] = w2s[i] / g_linear;
+        }
+        ivantsov_batch::getPhi(alpha_w2s.data(), alphas.data(), size);
+        ivantsov_batch::getPhi(beta_w2s.data(), betas.data(), size);
+        for (size_t i = 0; i < size; ++i) {
+            coeffs[i] = {1.0 / (1.0 + alphas[i]), 1.0 + betas[i], 1.0};
+        }
+    }
 }
@@ -10,6 +10,9 @@
 #pragma once
 
 #include <array>
+#include <span>
+
+#include "../../helpers.hpp"
 
 namespace zldsp::filter {
     class IvantsovSVFCoeff {
@@ -68,6 +71,25 @@ namespace zldsp::filter {
 
         static std::array<double, 5> get2TiltShelfWithCache(double g_linear_sqrt, const double* cache);
 
+        /**
+         * design the second-order stages of a cascade which share w0 and gain but have individual Q values
+         * @param filter_type kLowPass, kHighPass, kAllPass, kLowShelf, kHighShelf or kTiltShelf
+         * @param w0 the normalized frequency
+         * @param g the gain of each stage in dB
+         * @param qs the Q value of each stage
+         * @param coeffs where the coeffs of each stage will be written
+         */
+        static void get2Cascade(FilterType filter_type, double w0, double g,
+                                std::span<const double> qs, std::span<std::array<double, 5>> coeffs);
+
+        /**
+         * design first-order high shelves which share the gain but have individual frequencies
+         * @param w0s the normalized frequency of each shelf
+         * @param g the gain in dB
+         * @param coeffs where the coeffs of each shelf will be written
+         */
+        static void get1HighShelves(std::span<const double> w0s, double g, std::span<std::array<double, 3>> coeffs);
+
         static std::array<double, 5> pack1stOrder(const std::array<double, 3>& coeff, const double makeup_gain = 1.0) {
             return {coeff[0] * makeup_gain, 0.0, coeff[1], coeff[2] * makeup_gain, 0.0};
         }
@@ -9,13 +9,65 @@
 
 #pragma once
 
+#include <array>
 #include <span>
+#include <type_traits>
 
 #include "../chore/smoothed_value.hpp"
 #include "../chore/decibels.hpp"
 #include "../vector/vector.hpp"
 
 namespace zldsp::gain {
+    namespace hn = hwy::HWY_NAMESPACE;
+
+    /**
+     * the linear ramp of a gain over the next samples
+     * the i-th next gain (i >= 1) is start + i * step, clamped between start and target
+     */
+    template <typename FloatType>
+    struct GainRamp {
+        FloatType start, step, target;
+    };
+
+    /**
+     * multiply the buffer with the product of the ramps in one pass, the ramps are generated in registers
+     */
+    template <typename FloatType, size_t N>
+    void applyRamps(const std::array<GainRamp<FloatType>, N>& ramps,
+                    std::span<FloatType*> buffer, const size_t num_samples) {
+        static constexpr hn::ScalableTag<FloatType> d;
+        static constexpr size_t lanes = hn::MaxLanes(d);
+        std::array<FloatType, N> los{}, his{};
+        for (size_t k = 0; k < N; ++k) {
+            los[k] = std::min(ramps[k].start, ramps[k].target);
+            his[k] = std::max(ramps[k].start, ramps[k].target);
+        }
+        const auto v_lanes = hn::Set(d, static_cast<FloatType>(lanes));
+        auto v_idx = hn::Iota(d, FloatType(1));
+        size_t i = 0;
+        for (; i + lanes <= num_samples; i += lanes) {
+            auto v_gain = hn::Set(d, FloatType(1));
+            for (size_t k = 0; k < N; ++k) {
+                const auto v_ramp = hn::MulAdd(v_idx, hn::Set(d, ramps[k].step), hn::Set(d, ramps[k].start));
+                v_gain = hn::Mul(v_gain, hn::Min(hn::Max(v_ramp, hn::Set(d, los[k])), hn::Set(d, his[k])));
+            }
+            for (auto* chan : buffer) {
+                hn::StoreU(hn::Mul(hn::LoadU(d, chan + i), v_gain), d, chan + i);
+            }
+            v_idx = hn::Add(v_idx, v_lanes);
+        }
+        for (; i < num_samples; ++i) {
+            const auto idx = static_cast<FloatType>(i + 1);
+            FloatType gain{1};
+            for (size_t k = 0; k < N; ++k) {
+                gain *= std::clamp(ramps[k].start + idx * ramps[k].step, los[k], his[k]);
+            }
+            for (auto* chan : buffer) {
+                chan[i] *= gain;
+            }
+        }
+    }
+
     template <typename FloatType>
     class Gain {
     public:
@@ -68,18 +120,67 @@ namespace zldsp::gain {
                     vector::multiply(buffer[chan], gain_.getCurrent(), num_samples);
                 }
             } else {
-                for (size_t idx = 0; idx < num_samples; ++idx) {
-                    const auto gain = gain_.getNext();
-                    if constexpr (!bypass) {
-                        for (size_t chan = 0; chan < buffer.size(); ++chan) {
-                            buffer[chan][idx] *= gain;
-                        }
-                    }
+                if constexpr (!bypass) {
+                    applyRamps<FloatType, 1>({getRamp()}, buffer, num_samples);
                 }
+                gain_.skip(num_samples);
             }
         }
 
+        /**
+         * get the ramp of the next samples
+         */
+        [[nodiscard]] GainRamp<FloatType> getRamp() const noexcept {
+            return {gain_.getCurrent(), gain_.getIncrement(), gain_.getTarget()};
+        }
+
+        /**
+         * skip the next num_samples samples without processing
+         */
+        void skip(const size_t num_samples) noexcept {
+            gain_.skip(num_samples);
+        }
+
     private:
         zldsp::chore::SmoothedValue<FloatType, zldsp::chore::SmoothedTypes::kFixLin> gain_{FloatType(1)};
     };
+
+    /**
+     * process several gains which are applied back to back, with the product of them in a single pass
+     * the result agrees with processing the gains one after another within rounding errors
+     * @param gains
+     * @param buffer
+     * @param num_samples
+     */
+    template <bool bypass = false, typename FloatType, size_t N>
+    void processProduct(const std::array<Gain<FloatType>*, N>& gains,
+                        std::span<std::type_identity_t<FloatType>*> buffer, const size_t num_samples) {
+        bool is_smoothing = false;
+        for (const auto* gain : gains) {
+            is_smoothing = is_smoothing || gain->isSmoothing();
+        }
+        if (!is_smoothing) {
+            if constexpr (bypass) {
+                return;
+            }
+            FloatType product{1};
+            for (const auto* gain : gains) {
+                product *= gain->getCurrentGainLinear();
+            }
+            for (size_t chan = 0; chan < buffer.size(); ++chan) {
+                vector::multiply(buffer[chan], product, num_samples);
+            }
+            return;
+        }
+        if constexpr (!bypass) {
+            std::array<GainRamp<FloatType>, N> ramps{};
+            for (size_t k = 0; k < N; ++k) {
+                ramps[k] = gains[k]->getRamp();
+            }
+            applyRamps(ramps, buffer, num_samples);
+        }
+        for (auto* gain : gains) {
+            gain->skip(num_samples);
+        }
+    }
 }
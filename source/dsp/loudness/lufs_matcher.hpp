@@ -10,16 +10,26 @@
 #pragma once
 
 #include <atomic>
+#include <cmath>
+#include <mutex>
 #include "lufs_meter.hpp"
+#include "../container/fifo/abstract_fifo.hpp"
 
 namespace zldsp::loudness {
     /**
      * an integrated matcher which matches the loudness of pre and post
+     * in real-time mode the audio thread only forwards pre and post through a lock-free FIFO,
+     * K-weighting, gating and integration happen when measure() is called on a measurement thread
+     * in offline mode everything happens inline on the processing thread, so renders are deterministic
+     * the measurement thread may be shared by many instances, if it falls more than kFIFOSeconds behind,
+     * whole blocks are dropped from both pre and post, so the diff stays matched but is measured on fewer blocks
      * @tparam FloatType the float type of input audio buffer
      */
     template <typename FloatType>
     class LUFSMatcher {
     public:
+        static constexpr double kFIFOSeconds = 2.0;
+
         /**
          *
          * @param use_low_pass whether to use an extra lowpass filter at 22,000 Hz
@@ -30,17 +40,50 @@ namespace zldsp::loudness {
         }
 
         void prepare(const double sample_rate, const size_t num_channels) {
+            const std::lock_guard<std::mutex> lock{meter_mutex_};
             pre_loudness_meter_.prepare(sample_rate, num_channels);
             post_loudness_meter_.prepare(sample_rate, num_channels);
             sample_rate_ = sample_rate;
-            reset();
+            num_channels_ = num_channels;
+            // hold kFIFOSeconds of audio, which covers many time slices of a busy shared measurement thread
+            const auto capacity = static_cast<int>(std::ceil(sample_rate * kFIFOSeconds)) + 1;
+            fifo_.setCapacity(capacity);
+            fifo_buffers_.resize(2 * num_channels);
+            for (auto& buffer : fifo_buffers_) {
+                buffer.resize(static_cast<size_t>(capacity));
+            }
+            pre_pointers_.resize(num_channels);
+            post_pointers_.resize(num_channels);
+            pending_num_ = 0;
+            to_reset_.store(false, std::memory_order::relaxed);
+            resetMeasurement();
         }
 
+        /**
+         * reset the measurement, must be called on the processing thread
+         */
         void reset() {
-            pre_loudness_meter_.reset();
-            post_loudness_meter_.reset();
+            pending_num_ = 0;
             loudness_diff_.store(FloatType(0), std::memory_order::relaxed);
-            current_count_ = 0.0;
+            if (is_real_time_.load(std::memory_order::relaxed)) {
+                to_reset_.store(true, std::memory_order::release);
+            } else {
+                const std::lock_guard<std::mutex> lock{meter_mutex_};
+                resetMeasurement();
+            }
+        }
+
+        /**
+         * switch between real-time and offline mode, must be called on the processing thread
+         * the measurement restarts when the mode changes
+         * @param is_real_time
+         */
+        void setRealTime(const bool is_real_time) {
+            if (is_real_time == is_real_time_.load(std::memory_order::relaxed)) {
+                return;
+            }
+            is_real_time_.store(is_real_time, std::memory_order::relaxed);
+            reset();
         }
 
         /**
@@ -49,7 +92,16 @@ namespace zldsp::loudness {
          * @param num_samples
          */
         void processPre(std::span<FloatType*> pre, const size_t num_samples) {
-            pre_loudness_meter_.process(pre, num_samples);
+            if (!is_real_time_.load(std::memory_order::relaxed)) {
+                const std::lock_guard<std::mutex> lock{meter_mutex_};
+                pre_loudness_meter_.process(pre, num_samples);
+                return;
+            }
+            // drop the whole block if the measurement thread falls behind
+            pending_num_ = fifo_.getNumFree() >= static_cast<int>(num_samples) ? num_samples : 0;
+            if (pending_num_ > 0) {
+                writeToFIFO(pre, 0, num_samples);
+            }
         }
 
         /**
@@ -58,14 +110,44 @@ namespace zldsp::loudness {
          * @param num_samples
          */
         void processPost(std::span<FloatType*> post, const size_t num_samples) {
-            post_loudness_meter_.process(post, num_samples);
-            current_count_ += static_cast<double>(num_samples);
-            while (current_count_ >= sample_rate_) {
-                current_count_ -= sample_rate_;
-                const auto pre_loudness = pre_loudness_meter_.getIntegratedLoudness();
-                const auto post_loudness = post_loudness_meter_.getIntegratedLoudness();
-                loudness_diff_.store(post_loudness - pre_loudness, std::memory_order::relaxed);
+            if (!is_real_time_.load(std::memory_order::relaxed)) {
+                const std::lock_guard<std::mutex> lock{meter_mutex_};
+                post_loudness_meter_.process(post, num_samples);
+                updateDiff(num_samples);
+                return;
+            }
+            if (pending_num_ != num_samples) {
+                pending_num_ = 0;
+                return;
             }
+            writeToFIFO(post, num_channels_, num_samples);
+            fifo_.finishWrite(static_cast<int>(num_samples));
+            pending_num_ = 0;
+        }
+
+        /**
+         * measure the forwarded audio and update the diff, call it regularly on the measurement thread
+         * it never blocks the processing thread
+         */
+        void measure() {
+            if (!is_real_time_.load(std::memory_order::relaxed)) {
+                return;
+            }
+            const std::unique_lock<std::mutex> lock{meter_mutex_, std::try_to_lock};
+            if (!lock.owns_lock() || !is_real_time_.load(std::memory_order::relaxed)) {
+                return;
+            }
+            if (to_reset_.exchange(false, std::memory_order::acquire)) {
+                resetMeasurement();
+            }
+            const auto num_ready = fifo_.getNumReady();
+            if (num_ready <= 0) {
+                return;
+            }
+            const auto range = fifo_.prepareToRead(num_ready);
+            measureFromFIFO(range.start_index1, range.block_size1);
+            measureFromFIFO(range.start_index2, range.block_size2);
+            fifo_.finishRead(num_ready);
         }
 
         /**
@@ -81,5 +163,68 @@ namespace zldsp::loudness {
         LUFSMeter<FloatType> pre_loudness_meter_, post_loudness_meter_;
         std::atomic<FloatType> loudness_diff_{FloatType(0)};
         double sample_rate_{48000}, current_count_{0};
+        size_t num_channels_{0};
+
+        // the meters are used by the measurement thread in real-time mode, and by the processing thread otherwise
+        std::mutex meter_mutex_;
+        // start in real-time mode, offline renders switch with setRealTime() before their first block
+        std::atomic<bool> is_real_time_{true};
+        std::atomic<bool> to_reset_{false};
+
+        // pre channels followed by post channels
+        container::AbstractFIFO fifo_;
+        std::vector<std::vector<FloatType>> fifo_buffers_;
+        std::vector<FloatType*> pre_pointers_, post_pointers_;
+        size_t pending_num_{0};
+
+        void resetMeasurement() {
+            pre_loudness_meter_.reset();
+            post_loudness_meter_.reset();
+            loudness_diff_.store(FloatType(0), std::memory_order::relaxed);
+            current_count_ = 0.0;
+            const auto num_ready = fifo_.getNumReady();
+            if (num_ready > 0) {
+                fifo_.finishRead(num_ready);
+            }
+        }
+
+        void writeToFIFO(std::span<FloatType*> buffer, const size_t chan_offset, const size_t num_samples) {
+            const auto range = fifo_.prepareToWrite(static_cast<int>(num_samples));
+            for (size_t chan = 0; chan < num_channels_; ++chan) {
+                auto& fifo_buffer{fifo_buffers_[chan_offset + chan]};
+                if (range.block_size1 > 0) {
+                    vector::copy(fifo_buffer.data() + range.start_index1, buffer[chan],
+                                 static_cast<size_t>(range.block_size1));
+                }
+                if (range.block_size2 > 0) {
+                    vector::copy(fifo_buffer.data() + range.start_index2, buffer[chan] + range.block_size1,
+                                 static_cast<size_t>(range.block_size2));
+                }
+            }
+        }
+
+        void measureFromFIFO(const int start_index, const int block_size) {
+            if (block_size <= 0) {
+                return;
+            }
+            for (size_t chan = 0; chan < num_channels_; ++chan) {
+                pre_pointers_[chan] = fifo_buffers_[chan].data() + start_index;
+                post_pointers_[chan] = fifo_buffers_[num_channels_ + chan].data() + start_index;
+            }
+            const auto num_samples = static_cast<size_t>(block_size);
+            pre_loudness_meter_.process(std::span(pre_pointers_), num_samples);
+            post_loudness_meter_.process(std::span(post_pointers_), num_samples);
+            updateDiff(num_samples);
+        }
+
+        void updateDiff(const size_t num_samples) {
+            current_count_ += static_cast<double>(num_samples);
+            while (current_count_ >= sample_rate_) {
+                current_count_ -= sample_rate_;
+                const auto pre_loudness = pre_loudness_meter_.getIntegratedLoudness();
+                const auto post_loudness = post_loudness_meter_.getIntegratedLoudness();
+                loudness_diff_.store(post_loudness - pre_loudness, std::memory_order::relaxed);
+            }
+        }
     };
 }
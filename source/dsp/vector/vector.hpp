@@ -14,16 +14,10 @@
 #include "vector_transform/vector_sub.hpp"
 #include "vector_transform/vector_multiply.hpp"
 #include "vector_transform/vector_clamp.hpp"
-#include "vector_transform/vector_mag_to_db.hpp"
 #include "vector_transform/vector_flip.hpp"
-#include "vector_transform/vector_log.hpp"
 #include "vector_transform/vector_fma.hpp"
 
-#include "vector_reduce/vector_sum.hpp"
-#include "vector_reduce/vector_sum_sqr.hpp"
-#include "vector_reduce/vector_dot_product.hpp"
-#include "vector_reduce/vector_max_of.hpp"
-#include "vector_reduce/vector_max_abs_of.hpp"
+#include "vector_dispatch.hpp"
 
 namespace zldsp::vector {
     template <typename F>
@@ -0,0 +1,151 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+
+#undef HWY_TARGET_INCLUDE
+#define HWY_TARGET_INCLUDE "dsp/vector/vector_dispatch.cpp"
+#include <hwy/foreach_target.h>
+#include <hwy/highway.h>
+#include <hwy/contrib/math/math-inl.h>
+
+#include "vector_transform/vector_log.hpp"
+#include "vector_transform/vector_mag_to_db.hpp"
+#include "vector_reduce/vector_sum.hpp"
+#include "vector_reduce/vector_sum_sqr.hpp"
+#include "vector_reduce/vector_dot_product.hpp"
+#include "vector_reduce/vector_max_of.hpp"
+#include "vector_reduce/vector_max_abs_of.hpp"
+
+HWY_BEFORE_NAMESPACE();
+
+namespace zldsp::vector::HWY_NAMESPACE {
+    template <typename F>
+    void LogImpl(F* HWY_RESTRICT in, const size_t size, const bool use_min) {
+        if (use_min) {
+            log<F, true>(in, size);
+        } else {
+            log<F, false>(in, size);
+        }
+    }
+
+    void LogF32(float* HWY_RESTRICT in, const size_t size, const bool use_min) { LogImpl(in, size, use_min); }
+    void LogF64(double* HWY_RESTRICT in, const size_t size, const bool use_min) { LogImpl(in, size, use_min); }
+
+    void MagToDbF32(float* HWY_RESTRICT in, const size_t size) { mag_to_db(in, size); }
+    void MagToDbF64(double* HWY_RESTRICT in, const size_t size) { mag_to_db(in, size); }
+
+    void SqrMagToDbF32(float* HWY_RESTRICT in, const size_t size) { sqr_mag_to_db(in, size); }
+    void SqrMagToDbF64(double* HWY_RESTRICT in, const size_t size) { sqr_mag_to_db(in, size); }
+
+    void SqrMagToDbOutF32(float* HWY_RESTRICT out, float* HWY_RESTRICT in, const size_t size) {
+        sqr_mag_to_db(out, in, size);
+    }
+
+    void SqrMagToDbOutF64(double* HWY_RESTRICT out, double* HWY_RESTRICT in, const size_t size) {
+        sqr_mag_to_db(out, in, size);
+    }
+
+    float SumF32(const float* HWY_RESTRICT in, const size_t size) { return sum(in, size); }
+    double SumF64(const double* HWY_RESTRICT in, const size_t size) { return sum(in, size); }
+
+    float SumSqrF32(const float* HWY_RESTRICT in, const size_t size) { return sum_sqr(in, size); }
+    double SumSqrF64(const double* HWY_RESTRICT in, const size_t size) { return sum_sqr(in, size); }
+
+    float DotProductF32(const float* HWY_RESTRICT in0, const float* HWY_RESTRICT in1, const size_t size) {
+        return dot_product(in0, in1, size);
+    }
+
+    double DotProductF64(const double* HWY_RESTRICT in0, const double* HWY_RESTRICT in1, const size_t size) {
+        return dot_product(in0, in1, size);
+    }
+
+    float MaxOfF32(const float* HWY_RESTRICT in, const size_t size) { return max_of(in, size); }
+    double MaxOfF64(const double* HWY_RESTRICT in, const size_t size) { return max_of(in, size); }
+
+    float MaxAbsOfF32(const float* HWY_RESTRICT in, const size_t size) { return max_abs_of(in, size); }
+    double MaxAbsOfF64(const double* HWY_RESTRICT in, const size_t size) { return max_abs_of(in, size); }
+
+    const char* TargetName() { return hwy::TargetName(HWY_TARGET); }
+}
+
+HWY_AFTER_NAMESPACE();
+
+#if HWY_ONCE
+
+#include "vector_dispatch.hpp"
+
+namespace zldsp::vector {
+    HWY_EXPORT(LogF32);
+    HWY_EXPORT(LogF64);
+    HWY_EXPORT(MagToDbF32);
+    HWY_EXPORT(MagToDbF64);
+    HWY_EXPORT(SqrMagToDbF32);
+    HWY_EXPORT(SqrMagToDbF64);
+    HWY_EXPORT(SqrMagToDbOutF32);
+    HWY_EXPORT(SqrMagToDbOutF64);
+    HWY_EXPORT(SumF32);
+    HWY_EXPORT(SumF64);
+    HWY_EXPORT(SumSqrF32);
+    HWY_EXPORT(SumSqrF64);
+    HWY_EXPORT(DotProductF32);
+    HWY_EXPORT(DotProductF64);
+    HWY_EXPORT(MaxOfF32);
+    HWY_EXPORT(MaxOfF64);
+    HWY_EXPORT(MaxAbsOfF32);
+    HWY_EXPORT(MaxAbsOfF64);
+    HWY_EXPORT(TargetName);
+
+    namespace dispatch {
+        void log(float* in, const size_t size, const bool use_min) {
+            HWY_DYNAMIC_DISPATCH(LogF32)(in, size, use_min);
+        }
+
+        void log(double* in, const size_t size, const bool use_min) {
+            HWY_DYNAMIC_DISPATCH(LogF64)(in, size, use_min);
+        }
+
+        void mag_to_db(float* in, const size_t size) { HWY_DYNAMIC_DISPATCH(MagToDbF32)(in, size); }
+        void mag_to_db(double* in, const size_t size) { HWY_DYNAMIC_DISPATCH(MagToDbF64)(in, size); }
+
+        void sqr_mag_to_db(float* in, const size_t size) { HWY_DYNAMIC_DISPATCH(SqrMagToDbF32)(in, size); }
+        void sqr_mag_to_db(double* in, const size_t size) { HWY_DYNAMIC_DISPATCH(SqrMagToDbF64)(in, size); }
+
+        void sqr_mag_to_db(float* out, float* in, const size_t size) {
+            HWY_DYNAMIC_DISPATCH(SqrMagToDbOutF32)(out, in, size);
+        }
+
+        void sqr_mag_to_db(double* out, double* in, const size_t size) {
+            HWY_DYNAMIC_DISPATCH(SqrMagToDbOutF64)(out, in, size);
+        }
+
+        float sum(const float* in, const size_t size) { return HWY_DYNAMIC_DISPATCH(SumF32)(in, size); }
+        double sum(const double* in, const size_t size) { return HWY_DYNAMIC_DISPATCH(SumF64)(in, size); }
+
+        float sum_sqr(const float* in, const size_t size) { return HWY_DYNAMIC_DISPATCH(SumSqrF32)(in, size); }
+        double sum_sqr(const double* in, const size_t size) { return HWY_DYNAMIC_DISPATCH(SumSqrF64)(in, size); }
+
+        float dot_product(const float* in0, const float* in1, const size_t size) {
+            return HWY_DYNAMIC_DISPATCH(DotProductF32)(in0, in1, size);
+        }
+
+        double dot_product(const double* in0, const double* in1, const size_t size) {
+            return HWY_DYNAMIC_DISPATCH(DotProductF64)(in0, in1, size);
+        }
+
+        float max_of(const float* in, const size_t size) { return HWY_DYNAMIC_DISPATCH(MaxOfF32)(in, size); }
+        double max_of(const double* in, const size_t size) { return HWY_DYNAMIC_DISPATCH(MaxOfF64)(in, size); }
+
+        float max_abs_of(const float* in, const size_t size) { return HWY_DYNAMIC_DISPATCH(MaxAbsOfF32)(in, size); }
+        double max_abs_of(const double* in, const size_t size) { return HWY_DYNAMIC_DISPATCH(MaxAbsOfF64)(in, size); }
+
+        const char* getTargetName() { return HWY_DYNAMIC_DISPATCH(TargetName)(); }
+    }
+}
+
+#endif
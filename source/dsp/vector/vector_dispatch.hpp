@@ -0,0 +1,154 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <type_traits>
+
+#include "vector_transform/vector_log.hpp"
+#include "vector_transform/vector_mag_to_db.hpp"
+#include "vector_reduce/vector_sum.hpp"
+#include "vector_reduce/vector_sum_sqr.hpp"
+#include "vector_reduce/vector_dot_product.hpp"
+#include "vector_reduce/vector_max_of.hpp"
+#include "vector_reduce/vector_max_abs_of.hpp"
+
+/**
+ * entry points of the compute-bound kernels
+ * with ZL_HWY_DYNAMIC_DISPATCH, float and double kernels are compiled for every Highway target in
+ * vector_dispatch.cpp and the best one is chosen at runtime, otherwise the static kernels are inlined
+ * IdealBatch::process is dispatched the same way in ideal_batch_dispatch.cpp
+ * the memory-bound kernels and the other inline Highway loops of the filters (e.g. Ideal, DynamicSideHandler)
+ * are not dispatched, they always run on the static target
+ */
+namespace zldsp::vector {
+    namespace dispatch {
+        void log(float* in, size_t size, bool use_min);
+        void log(double* in, size_t size, bool use_min);
+
+        void mag_to_db(float* in, size_t size);
+        void mag_to_db(double* in, size_t size);
+
+        void sqr_mag_to_db(float* in, size_t size);
+        void sqr_mag_to_db(double* in, size_t size);
+
+        void sqr_mag_to_db(float* out, float* in, size_t size);
+        void sqr_mag_to_db(double* out, double* in, size_t size);
+
+        float sum(const float* in, size_t size);
+        double sum(const double* in, size_t size);
+
+        float sum_sqr(const float* in, size_t size);
+        double sum_sqr(const double* in, size_t size);
+
+        float dot_product(const float* in0, const float* in1, size_t size);
+        double dot_product(const double* in0, const double* in1, size_t size);
+
+        float max_of(const float* in, size_t size);
+        double max_of(const double* in, size_t size);
+
+        float max_abs_of(const float* in, size_t size);
+        double max_abs_of(const double* in, size_t size);
+
+        /**
+         * @return the name of the Highway target chosen at runtime, e.g. "AVX2"
+         */
+        const char* getTargetName();
+    }
+
+#if defined(ZL_HWY_DYNAMIC_DISPATCH)
+    template <typename F>
+    inline constexpr bool kIsDispatched = std::is_same_v<F, float> || std::is_same_v<F, double>;
+#else
+    template <typename F>
+    inline constexpr bool kIsDispatched = false;
+#endif
+
+    template <typename F, bool use_min = false>
+    HWY_INLINE void log(F* __restrict in, const size_t size) {
+        if constexpr (kIsDispatched<F>) {
+            dispatch::log(in, size, use_min);
+        } else {
+            HWY_NAMESPACE::log<F, use_min>(in, size);
+        }
+    }
+
+    template <typename F>
+    HWY_INLINE void mag_to_db(F* __restrict in, const size_t size) {
+        if constexpr (kIsDispatched<F>) {
+            dispatch::mag_to_db(in, size);
+        } else {
+            HWY_NAMESPACE::mag_to_db(in, size);
+        }
+    }
+
+    template <typename F>
+    HWY_INLINE void sqr_mag_to_db(F* __restrict in, const size_t size) {
+        if constexpr (kIsDispatched<F>) {
+            dispatch::sqr_mag_to_db(in, size);
+        } else {
+            HWY_NAMESPACE::sqr_mag_to_db(in, size);
+        }
+    }
+
+    template <typename F>
+    HWY_INLINE void sqr_mag_to_db(F* __restrict out, F* __restrict in, const size_t size) {
+        if constexpr (kIsDispatched<F>) {
+            dispatch::sqr_mag_to_db(out, in, size);
+        } else {
+            HWY_NAMESPACE::sqr_mag_to_db(out, in, size);
+        }
+    }
+
+    template <typename F>
+    HWY_INLINE F sum(const F* HWY_RESTRICT in, const size_t size) {
+        if constexpr (kIsDispatched<F>) {
+            return dispatch::sum(in, size);
+        } else {
+            return HWY_NAMESPACE::sum(in, size);
+        }
+    }
+
+    template <typename F>
+    HWY_INLINE F sum_sqr(const F* HWY_RESTRICT in, const size_t size) {
+        if constexpr (kIsDispatched<F>) {
+            return dispatch::sum_sqr(in, size);
+        } else {
+            return HWY_NAMESPACE::sum_sqr(in, size);
+        }
+    }
+
+    template <typename F>
+    HWY_INLINE F dot_product(const F* HWY_RESTRICT in0, const F* HWY_RESTRICT in1, const size_t size) {
+        if constexpr (kIsDispatched<F>) {
+            return dispatch::dot_product(in0, in1, size);
+        } else {
+            return HWY_NAMESPACE::dot_product(in0, in1, size);
+        }
+    }
+
+    template <typename F>
+    HWY_INLINE F max_of(const F* __restrict in, const size_t size) {
+        if constexpr (kIsDispatched<F>) {
+            return dispatch::max_of(in, size);
+        } else {
+            return HWY_NAMESPACE::max_of(in, size);
+        }
+    }
+
+    template <typename F>
+    HWY_INLINE F max_abs_of(const F* __restrict in, const size_t size) {
+        if constexpr (kIsDispatched<F>) {
+            return dispatch::max_abs_of(in, size);
+        } else {
+            return HWY_NAMESPACE::max_abs_of(in, size);
+        }
+    }
+}
@@ -7,11 +7,19 @@
 //
 // You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
 
-#pragma once
+// per-target header, it is included once for each Highway target by vector_dispatch.cpp
+#if defined(ZLDSP_VECTOR_DOT_PRODUCT_HPP_) == defined(HWY_TARGET_TOGGLE)
+#ifdef ZLDSP_VECTOR_DOT_PRODUCT_HPP_
+#undef ZLDSP_VECTOR_DOT_PRODUCT_HPP_
+#else
+#define ZLDSP_VECTOR_DOT_PRODUCT_HPP_
+#endif
 
 #include "../highway_import.hpp"
 
-namespace zldsp::vector {
+HWY_BEFORE_NAMESPACE();
+
+namespace zldsp::vector::HWY_NAMESPACE {
     namespace hn = hwy::HWY_NAMESPACE;
 
     template <typename F>
@@ -64,3 +72,7 @@ namespace zldsp::vector {
         return scalar_sum;
     }
 }
+
+HWY_AFTER_NAMESPACE();
+
+#endif
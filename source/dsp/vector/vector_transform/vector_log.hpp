@@ -7,11 +7,19 @@
 //
 // You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
 
-#pragma once
+// per-target header, it is included once for each Highway target by vector_dispatch.cpp
+#if defined(ZLDSP_VECTOR_LOG_HPP_) == defined(HWY_TARGET_TOGGLE)
+#ifdef ZLDSP_VECTOR_LOG_HPP_
+#undef ZLDSP_VECTOR_LOG_HPP_
+#else
+#define ZLDSP_VECTOR_LOG_HPP_
+#endif
 
 #include "../highway_import.hpp"
 
-namespace zldsp::vector {
+HWY_BEFORE_NAMESPACE();
+
+namespace zldsp::vector::HWY_NAMESPACE {
     namespace hn = hwy::HWY_NAMESPACE;
 
     template <typename F, bool use_min = false>
@@ -39,4 +47,8 @@ namespace zldsp::vector {
             }
         }
     }
-}
\ No newline at end of file
+}
+
+HWY_AFTER_NAMESPACE();
+
+#endif
@@ -7,11 +7,19 @@
 //
 // You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
 
-#pragma once
+// per-target header, it is included once for each Highway target by vector_dispatch.cpp
+#if defined(ZLDSP_VECTOR_MAG_TO_DB_HPP_) == defined(HWY_TARGET_TOGGLE)
+#ifdef ZLDSP_VECTOR_MAG_TO_DB_HPP_
+#undef ZLDSP_VECTOR_MAG_TO_DB_HPP_
+#else
+#define ZLDSP_VECTOR_MAG_TO_DB_HPP_
+#endif
 
 #include "../highway_import.hpp"
 
-namespace zldsp::vector {
+HWY_BEFORE_NAMESPACE();
+
+namespace zldsp::vector::HWY_NAMESPACE {
     namespace hn = hwy::HWY_NAMESPACE;
 
     template <typename F>
@@ -71,3 +79,7 @@ namespace zldsp::vector {
         }
     }
 }
+
+HWY_AFTER_NAMESPACE();
+
+#endif
@@ -13,6 +13,7 @@
 #include <juce_gui_basics/juce_gui_basics.h>
 
 #include "../state/state_definitions.hpp"
+#include "shared_resources.hpp"
 
 namespace zlgui {
     enum class MouseActionType {
@@ -207,6 +208,20 @@ namespace zlgui {
             loadFromAPVTS();
         }
 
+        /**
+         * get the typeface shared by all editors
+         */
+        juce::Typeface::Ptr getSharedTypeface(const void* data, const size_t size) {
+            return shared_resources_->getTypeface(data, size);
+        }
+
+        /**
+         * get the drawable shared by all editors, it should only be used as a template
+         */
+        juce::Drawable* getSharedDrawable(const void* data, const size_t size) {
+            return shared_resources_->getDrawable(data, size);
+        }
+
         void setFontMode(const size_t font_mode) {
             font_mode_ = font_mode;
         }
@@ -593,6 +608,7 @@ namespace zlgui {
 
     private:
         juce::AudioProcessorValueTreeState& state;
+        juce::SharedResourcePointer<SharedResources> shared_resources_;
         juce::ValueTree panel_value_tree_{"panel_setting_tree"};
         juce::ValueTree solo_whole_idx_tree_{"solo_whole_idx_tree"};
 
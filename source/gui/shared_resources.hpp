@@ -0,0 +1,59 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+#include <map>
+#include <memory>
+
+namespace zlgui {
+    /**
+     * immutable GUI resources shared by all editors in the host process
+     * hold it with juce::SharedResourcePointer so that it lives as long as any editor
+     * all functions must be called on the message thread
+     */
+    class SharedResources {
+    public:
+        SharedResources() = default;
+
+        /**
+         * get the typeface created from the binary data, it is created on first use
+         * @param data
+         * @param size
+         * @return
+         */
+        juce::Typeface::Ptr getTypeface(const void* data, const size_t size) {
+            auto& typeface{typefaces_[data]};
+            if (typeface == nullptr) {
+                typeface = juce::Typeface::createSystemTypefaceFor(data, size);
+            }
+            return typeface;
+        }
+
+        /**
+         * get the drawable parsed from the binary data, it is parsed on first use
+         * the drawable is shared, so it should only be used as a template (e.g., with createCopy())
+         * @param data
+         * @param size
+         * @return
+         */
+        juce::Drawable* getDrawable(const void* data, const size_t size) {
+            auto& drawable{drawables_[data]};
+            if (drawable == nullptr) {
+                drawable = juce::Drawable::createFromImageData(data, size);
+            }
+            return drawable.get();
+        }
+
+    private:
+        std::map<const void*, juce::Typeface::Ptr> typefaces_;
+        std::map<const void*, std::unique_ptr<juce::Drawable>> drawables_;
+    };
+}
@@ -70,13 +70,13 @@ namespace zlpanel {
         p_ref_(p), base_(base),
         match_fft_panel_(match_fft_panel),
         control_background_(base),
-        save_drawable_(juce::Drawable::createFromImageData(BinaryData::save_svg,
-                                                           BinaryData::save_svgSize)),
-        save_button_(base, save_drawable_.get(), nullptr,
+        save_drawable_(base.getSharedDrawable(BinaryData::save_svg,
+                                              BinaryData::save_svgSize)),
+        save_button_(base, save_drawable_, nullptr,
                      tooltip_helper.getToolTipText(multilingual::kEQMatchSave)),
-        draw_drawable_(juce::Drawable::createFromImageData(BinaryData::draw_svg,
-                                                           BinaryData::draw_svgSize)),
-        draw_button_(base, draw_drawable_.get(), draw_drawable_.get(),
+        draw_drawable_(base.getSharedDrawable(BinaryData::draw_svg,
+                                              BinaryData::draw_svgSize)),
+        draw_button_(base, draw_drawable_, draw_drawable_,
                      tooltip_helper.getToolTipText(multilingual::kEQMatchDiffDraw)),
         target_box_({"Side", "Preset", "Flat", "Balanced", "Natural"}, base,
                     tooltip_helper.getToolTipText(multilingual::kEQMatchTarget),
@@ -96,9 +96,9 @@ namespace zlpanel {
         slope_slider_("", base,
                       tooltip_helper.getToolTipText(multilingual::kEQMatchDiffSlope)),
         limit_combobox_({"6 dB", "12 dB", "30 dB", "Inf"}, base, ""),
-        start_drawable_(juce::Drawable::createFromImageData(BinaryData::start_svg,
-                                                            BinaryData::start_svgSize)),
-        fit_start_button_(base, start_drawable_.get(), nullptr,
+        start_drawable_(base.getSharedDrawable(BinaryData::start_svg,
+                                               BinaryData::start_svgSize)),
+        fit_start_button_(base, start_drawable_, nullptr,
                           tooltip_helper.getToolTipText(multilingual::kEQMatchFit)),
         num_band_slider_("", base,
                          tooltip_helper.getToolTipText(multilingual::kEQMatchNumBand)) {
@@ -174,6 +174,8 @@ namespace zlpanel {
 
         fit_start_button_.getButton().onClick = [this]() {
             if (match_fft_panel_.getMatchPhase() == MatchFFTPanel::MatchPhase::kMatch) {
+                // a second click stops the match early and keeps the filters fitted so far
+                match_fft_panel_.cancelMatch();
                 return;
             }
             for (size_t band = 0; band < zlp::kBandNum; ++band) {
@@ -205,10 +207,15 @@ namespace zlpanel {
         num_band_slider_.setBufferedToImage(true);
         addChildComponent(num_band_slider_);
 
+        status_label_.setLookAndFeel(&label_laf_);
+        status_label_.setJustificationType(juce::Justification::centred);
+        addChildComponent(status_label_);
+
         base_.getPanelValueTree().addListener(this);
     }
 
     MatchControlPanel::~MatchControlPanel() {
+        stopTimer();
         base_.getPanelValueTree().removeListener(this);
     }
 
@@ -279,6 +286,7 @@ namespace zlpanel {
             limit_combobox_.setBounds(temp_bound.removeFromTop(button_size));
             temp_bound.removeFromTop(padding);
             num_band_slider_.setBounds(temp_bound.removeFromBottom(temp_bound.getHeight() / 2));
+            status_label_.setBounds(num_band_slider_.getBounds());
             num_band_slider_.getSlider().setMouseDragSensitivity(small_slider_width);
             temp_bound.removeFromBottom(padding);
             fit_start_button_.setBounds(temp_bound.withSizeKeepingCentre(button_size, button_size));
@@ -287,8 +295,10 @@ namespace zlpanel {
 
     void MatchControlPanel::visibilityChanged() {
         if (!isVisible()) {
+            stopTimer();
             return;
         }
+        startTimerHz(10);
         [[maybe_unused]] const auto migration_result = migrateLegacyPresets(kPresetDirectory);
         [[maybe_unused]] const auto creation_result = ensureDirectoryExists(kPresetDirectory);
 
@@ -331,7 +341,8 @@ namespace zlpanel {
 
     void MatchControlPanel::loadFromPreset() {
         chooser_ = std::make_unique<juce::FileChooser>(
-            "Load the match preset...", kPresetDirectory, "*.csv",
+            "Load the match preset or a reference audio file...", kPresetDirectory,
+            "*.csv;" + match_fft_panel_.getReferenceWildcard(),
             true, false, nullptr);
         constexpr auto settingOpenFlags = juce::FileBrowserComponent::openMode |
             juce::FileBrowserComponent::canSelectFiles;
@@ -339,6 +350,10 @@ namespace zlpanel {
             if (chooser.getResults().size() <= 0) { return; }
             const juce::File preset_file(chooser.getResult());
             if (!preset_file.existsAsFile()) { return; }
+            if (!preset_file.hasFileExtension("csv")) {
+                match_fft_panel_.loadFromFile(preset_file);
+                return;
+            }
             if (juce::FileInputStream input(preset_file); input.openedOk()) {
                 preset_freqs_.resize(0);
                 preset_dbs_.resize(0);
@@ -387,4 +402,33 @@ namespace zlpanel {
             }
         }
     }
+
+    void MatchControlPanel::timerCallback() {
+        juce::String text;
+        if (match_fft_panel_.getMatchPhase() == MatchFFTPanel::MatchPhase::kMatch) {
+            const auto progress = match_fft_panel_.getMatchProgress();
+            text = juce::String(progress.num_band) + " | " + juce::String(progress.mse, 2);
+        } else if (match_fft_panel_.isAnalyzingReference()) {
+            text = "Analysing";
+            reference_hold_ticks_ = kReferenceHoldTicks;
+        } else {
+            // after the analysis, show how many times faster than real time the reference was analysed
+            // a short file may finish between two ticks, so a new speed also starts the hold
+            const auto speed = match_fft_panel_.getReferenceSpeed();
+            if (speed > 0.0 && speed != c_reference_speed_) {
+                reference_hold_ticks_ = kReferenceHoldTicks;
+            }
+            c_reference_speed_ = speed;
+            if (reference_hold_ticks_ > 0 && speed > 0.0) {
+                reference_hold_ticks_ -= 1;
+                text = juce::String(speed, 0) + "x";
+            }
+        }
+        if (text.isEmpty() || num_band_slider_.isVisible()) {
+            status_label_.setVisible(false);
+            return;
+        }
+        status_label_.setText(text, juce::dontSendNotification);
+        status_label_.setVisible(true);
+    }
 }
@@ -19,7 +19,8 @@
 
 namespace zlpanel {
     class MatchControlPanel final : public juce::Component,
-                                    private juce::ValueTree::Listener {
+                                    private juce::ValueTree::Listener,
+                                    private juce::Timer {
     public:
         explicit MatchControlPanel(PluginProcessor& p, zlgui::UIBase& base,
                                    MatchFFTPanel& match_fft_panel,
@@ -40,10 +41,10 @@ namespace zlpanel {
 
         PanelBackground control_background_;
 
-        const std::unique_ptr<juce::Drawable> save_drawable_;
+        juce::Drawable* const save_drawable_;
         zlgui::button::ClickButton save_button_;
 
-        const std::unique_ptr<juce::Drawable> draw_drawable_;
+        juce::Drawable* const draw_drawable_;
         zlgui::button::ClickButton draw_button_;
 
         zlgui::combobox::CompactCombobox target_box_;
@@ -61,10 +62,15 @@ namespace zlpanel {
 
         zlgui::combobox::CompactCombobox limit_combobox_;
 
-        const std::unique_ptr<juce::Drawable> start_drawable_;
+        juce::Drawable* const start_drawable_;
         zlgui::button::ClickButton fit_start_button_;
 
         zlgui::slider::CompactLinearSlider<false, false, false> num_band_slider_;
+        juce::Label status_label_;
+        // how many timer ticks the reference analysis speed stays on the status label
+        static constexpr int kReferenceHoldTicks = 30;
+        int reference_hold_ticks_{0};
+        double c_reference_speed_{0.0};
 
         std::unique_ptr<juce::FileChooser> chooser_;
         const juce::File kPresetDirectory =
@@ -81,5 +87,11 @@ namespace zlpanel {
         void loadFromPreset();
 
         void valueTreePropertyChanged(juce::ValueTree&, const juce::Identifier& property) override;
+
+        /**
+         * show the progress of the running match or of the reference analysis
+         * where the number of bands slider will appear
+         */
+        void timerCallback() override;
     };
 }
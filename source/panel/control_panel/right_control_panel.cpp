@@ -16,27 +16,27 @@ namespace zlpanel {
                                          const multilingual::TooltipHelper& tooltip_helper) :
         p_ref_(p), base_(base), updater_(),
         control_background_(base),
-        bypass_drawable_(juce::Drawable::createFromImageData(BinaryData::bypass_svg,
-                                                             BinaryData::bypass_svgSize)),
-        bypass_button_(base, bypass_drawable_.get(), bypass_drawable_.get(),
+        bypass_drawable_(base.getSharedDrawable(BinaryData::bypass_svg,
+                                                BinaryData::bypass_svgSize)),
+        bypass_button_(base, bypass_drawable_, bypass_drawable_,
                        tooltip_helper.getToolTipText(multilingual::kBandDynamicBypass)),
-        auto_drawable_(juce::Drawable::createFromImageData(BinaryData::circle_a_svg,
-                                                           BinaryData::circle_a_svgSize)),
-        auto_button_(base, auto_drawable_.get(), auto_drawable_.get(),
+        auto_drawable_(base.getSharedDrawable(BinaryData::circle_a_svg,
+                                              BinaryData::circle_a_svgSize)),
+        auto_button_(base, auto_drawable_, auto_drawable_,
                      tooltip_helper.getToolTipText(multilingual::kBandDynamicAuto)),
-        relative_drawable_(juce::Drawable::createFromImageData(BinaryData::circle_r_svg,
-                                                               BinaryData::circle_r_svgSize)),
-        relative_button_(base, relative_drawable_.get(), relative_drawable_.get(),
+        relative_drawable_(base.getSharedDrawable(BinaryData::circle_r_svg,
+                                                  BinaryData::circle_r_svgSize)),
+        relative_button_(base, relative_drawable_, relative_drawable_,
                          tooltip_helper.getToolTipText(multilingual::kBandDynamicRelative)),
-        swap_drawable_(juce::Drawable::createFromImageData(BinaryData::shuffle_svg,
-                                                           BinaryData::shuffle_svgSize)),
-        swap_button_(base, swap_drawable_.get(), swap_drawable_.get(),
+        swap_drawable_(base.getSharedDrawable(BinaryData::shuffle_svg,
+                                              BinaryData::shuffle_svgSize)),
+        swap_button_(base, swap_drawable_, swap_drawable_,
                      tooltip_helper.getToolTipText(multilingual::kBandSideSwap)),
-        extra_drawable_(juce::Drawable::createFromImageData(BinaryData::up_arrow_svg,
-                                                            BinaryData::up_arrow_svgSize)),
-        extra_button_(base, extra_drawable_.get(), extra_drawable_.get()),
-        link_drawable_(juce::Drawable::createFromImageData(BinaryData::link_svg, BinaryData::link_svgSize)),
-        link_button_(base, link_drawable_.get(), link_drawable_.get(),
+        extra_drawable_(base.getSharedDrawable(BinaryData::up_arrow_svg,
+                                               BinaryData::up_arrow_svgSize)),
+        extra_button_(base, extra_drawable_, extra_drawable_),
+        link_drawable_(base.getSharedDrawable(BinaryData::link_svg, BinaryData::link_svgSize)),
+        link_button_(base, link_drawable_, link_drawable_,
                      tooltip_helper.getToolTipText(multilingual::kBandDynamicSideLink)),
         ftype_box_(zlp::PSideFilterType::kChoices, base,
                    tooltip_helper.getToolTipText(multilingual::kBandDynamicSideFilterType)),
@@ -44,9 +44,9 @@ namespace zlpanel {
         smooth_type_box_(zlstate::PFFTSmoothType::kChoices, base, ""),
         smooth_type_attach_(smooth_type_box_.getBox(), p.parameters_NA_,
                             zlstate::PFFTSmoothType::kID, updater_),
-        freeze_drawable_(juce::Drawable::createFromImageData(BinaryData::freeze_svg,
-                                                             BinaryData::freeze_svgSize)),
-        freeze_button_(base, freeze_drawable_.get(), freeze_drawable_.get(),
+        freeze_drawable_(base.getSharedDrawable(BinaryData::freeze_svg,
+                                                BinaryData::freeze_svgSize)),
+        freeze_button_(base, freeze_drawable_, freeze_drawable_,
                        tooltip_helper.getToolTipText(multilingual::kFFTFreeze)),
         freeze_attach_(freeze_button_.getButton(), p.parameters_NA_,
                        zlstate::PFFTFreezeON::kID, updater_),
@@ -66,9 +66,9 @@ namespace zlpanel {
         }(), base, "", {}),
         lr_attachment_(lr_box_.getBox(), p.parameters_NA_,
                        zlstate::PFFTStereo::kID, updater_),
-        collision_drawable_(juce::Drawable::createFromImageData(BinaryData::collision_svg,
-                                                                BinaryData::collision_svgSize)),
-        collision_button_(base, collision_drawable_.get(), collision_drawable_.get(),
+        collision_drawable_(base.getSharedDrawable(BinaryData::collision_svg,
+                                                   BinaryData::collision_svgSize)),
+        collision_button_(base, collision_drawable_, collision_drawable_,
                           tooltip_helper.getToolTipText(multilingual::kFFTCollision)),
         collision_attach_(collision_button_.getButton(), p.parameters_NA_,
                           zlstate::PCollisionON::kID, updater_),
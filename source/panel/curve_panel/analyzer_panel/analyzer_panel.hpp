@@ -60,14 +60,14 @@ namespace zlpanel {
         zlgui::combobox::CompactCombobox smooth_type_box_;
         zlgui::attachment::ComboBoxAttachment<true> smooth_type_attach_;
 
-        const std::unique_ptr<juce::Drawable> freeze_drawable_;
+        juce::Drawable* const freeze_drawable_;
         zlgui::button::ClickButton freeze_button_;
         zlgui::attachment::ButtonAttachment<true> freeze_attach_;
 
         zlgui::combobox::CompactCombobox lr_box_;
         zlgui::attachment::ComboBoxAttachment<true> lr_attachment_;
 
-        const std::unique_ptr<juce::Drawable> collision_drawable_;
+        juce::Drawable* const collision_drawable_;
         zlgui::button::ClickButton collision_button_;
         zlgui::attachment::ButtonAttachment<true> collision_attach_;
 
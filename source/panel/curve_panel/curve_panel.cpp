@@ -13,7 +13,6 @@ namespace zlpanel {
     CurvePanel::CurvePanel(PluginProcessor& p,
                            zlgui::UIBase& base,
                            multilingual::TooltipHelper& tooltip_helper) :
-        Thread("curve_panel"),
         base_(base),
         background_panel_(p, base, tooltip_helper),
         fft_panel_(p, base),
@@ -21,7 +20,11 @@ namespace zlpanel {
         match_fft_panel_(p, base),
         scale_panel_(p, base, tooltip_helper),
         output_panel_(p, base, tooltip_helper),
-        analyzer_panel_(p, base, tooltip_helper) {
+        analyzer_panel_(p, base, tooltip_helper),
+        fft_task_("curve_panel", worker_pool_->getPool(),
+                  [this](const juce::ThreadPoolJob& job) { runFFT(job); }),
+        response_task_("response", worker_pool_->getPool(),
+                       [this](const juce::ThreadPoolJob& job) { runResponse(job); }) {
         background_panel_.setBufferedToImage(true);
         addAndMakeVisible(background_panel_);
         addAndMakeVisible(fft_panel_);
@@ -42,22 +45,36 @@ namespace zlpanel {
     }
 
     void CurvePanel::paintOverChildren(juce::Graphics&) {
-        notify();
-        response_panel_.notify();
+        if (governor_.update(juce::Time::getMillisecondCounterHiRes() * 1e-3)) {
+            const auto level = governor_.getLevel();
+            fft_panel_.setQualityLevel(level);
+            response_panel_.setQualityLevel(level);
+        }
+        // run the analysis on every other frame from kHalfRate
+        if (governor_.getLevel() >= FrameGovernor::kHalfRate) {
+            skip_next_frame_ = !skip_next_frame_;
+            if (skip_next_frame_) {
+                return;
+            }
+        }
+        fft_task_.trigger();
+        response_task_.trigger();
     }
 
-    void CurvePanel::run() {
-        while (!threadShouldExit()) {
-            const auto flag = wait(-1);
-            juce::ignoreUnused(flag);
-            if (is_match_on_.load(std::memory_order::relaxed)) {
-                match_fft_panel_.run(*this);
-            } else {
-                fft_panel_.run(*this);
-            }
+    void CurvePanel::runFFT(const juce::ThreadPoolJob& job) {
+        const FrameGovernor::ScopedCost cost{governor_};
+        if (is_match_on_.load(std::memory_order::relaxed)) {
+            match_fft_panel_.run(job);
+        } else {
+            fft_panel_.run(job);
         }
     }
 
+    void CurvePanel::runResponse(const juce::ThreadPoolJob& job) {
+        const FrameGovernor::ScopedCost cost{governor_};
+        response_panel_.run(job);
+    }
+
     void CurvePanel::resized() {
         const auto bound = getLocalBounds();
         background_panel_.setBounds(bound);
@@ -106,17 +123,13 @@ namespace zlpanel {
     }
 
     void CurvePanel::startThreads() {
-        startThread(juce::Thread::Priority::low);
-        response_panel_.startThread(juce::Thread::Priority::low);
+        fft_task_.start();
+        response_task_.start();
     }
 
     void CurvePanel::stopThreads() {
-        if (isThreadRunning()) {
-            stopThread(-1);
-        }
-        if (response_panel_.isThreadRunning()) {
-            response_panel_.stopThread(-1);
-        }
+        fft_task_.stop();
+        response_task_.stop();
     }
 
     void CurvePanel::valueTreePropertyChanged(juce::ValueTree&, const juce::Identifier& property) {
@@ -18,8 +18,7 @@
 
 namespace zlpanel {
     class CurvePanel final : public juce::Component,
-                             private juce::ValueTree::Listener,
-                             private juce::Thread {
+                             private juce::ValueTree::Listener {
     public:
         explicit CurvePanel(PluginProcessor& p, zlgui::UIBase& base,
                             multilingual::TooltipHelper& tooltip_helper);
@@ -28,8 +27,6 @@ namespace zlpanel {
 
         void paintOverChildren(juce::Graphics& g) override;
 
-        void run() override;
-
         void resized() override;
 
         void mouseDown(const juce::MouseEvent&) override;
@@ -58,6 +55,10 @@ namespace zlpanel {
             return match_fft_panel_;
         }
 
+        auto& getFrameGovernor() {
+            return governor_;
+        }
+
     private:
         zlgui::UIBase& base_;
         BackgroundPanel background_panel_;
@@ -69,6 +70,17 @@ namespace zlpanel {
         AnalyzerPanel analyzer_panel_;
         std::atomic<bool> is_match_on_{false};
 
+        FrameGovernor governor_;
+        bool skip_next_frame_{false};
+
+        juce::SharedResourcePointer<WorkerPool> worker_pool_;
+        WorkerTask fft_task_;
+        WorkerTask response_task_;
+
+        void runFFT(const juce::ThreadPoolJob& job);
+
+        void runResponse(const juce::ThreadPoolJob& job);
+
         void valueTreePropertyChanged(juce::ValueTree&, const juce::Identifier& property) override;
     };
 }
@@ -27,17 +27,15 @@ namespace zlpanel {
         fft_smooth_erb_value_idx_ref_(*p.parameters_NA_.getRawParameterValue(zlstate::PFFTSmoothERBValue::kID)),
         fft_smooth_type_idx_ref_(*p.parameters_NA_.getRawParameterValue(zlstate::PFFTSmoothType::kID)) {
         constexpr auto preallocate_space = 100 * 3 + 1;
-        for (auto& buffered_path : paths_) {
-            for (auto& path : buffered_path.getBuffer()) {
-                path.preallocateSpace(preallocate_space);
-            }
+        for (auto& path : paths_) {
+            path.preallocateSpace(preallocate_space);
         }
         for (auto& receiver : receivers_) {
             receiver.setON(true);
         }
         setInterceptsMouseClicks(false, false);
         base_.getPanelValueTree().addListener(this);
-        collision_colour_ = base_.getColourByIdx(zlgui::kCollisionColour);
+        lookAndFeelChanged();
     }
 
     FFTPanel::~FFTPanel() {
@@ -49,41 +47,12 @@ namespace zlpanel {
             skip_next_repaint_ = false;
             return;
         }
-        const auto pre_on = pre_ref_.load(std::memory_order::relaxed) > .5f;
-        const auto post_on = post_ref_.load(std::memory_order::relaxed) > .5f;
-        const auto side_on = side_ref_.load(std::memory_order::relaxed) > .5f;
-        const auto coll_on = coll_ref_.load(std::memory_order::relaxed) > .5f;
-        const std::array<bool, kNumSources> is_on{pre_on, post_on, side_on};
-        for (size_t i = 0; i < kNumSources; ++i) {
-            if (is_on[i]) {
-                paths_[i].pull();
-            }
-        }
-
-        if (is_on[0]) {
-            g.setColour(base_.getColourByIdx(zlgui::ColourIdx::kPreColour));
-            g.fillPath(paths_[0].getReader());
-        }
-        if (is_on[1]) {
-            const auto thickness = base_.getFontSize() * .2f;
-            g.setColour(base_.getColourByIdx(zlgui::ColourIdx::kPostColour).withAlpha(1.f));
-            g.strokePath(paths_[1].getReader(),
-                         {thickness, juce::PathStrokeType::curved, juce::PathStrokeType::rounded});
-            g.setColour(base_.getColourByIdx(zlgui::ColourIdx::kPostColour));
-            g.fillPath(paths_[1].getReader());
-        }
-        if (is_on[2]) {
-            g.setColour(base_.getColourByIdx(zlgui::ColourIdx::kSideColour));
-            g.fillPath(paths_[2].getReader());
-        }
-        if (coll_on && ((pre_on && post_on) || (side_on && post_on))) {
-            gradient_.pull();
-            const auto& gradient = gradient_.getReader();
-            if (gradient.getNumColours() >= 2) {
-                g.setGradientFill(gradient);
-                g.fillRect(getLocalBounds());
-            }
+        // re-rasterise at the new resolution when the window moves to another display or gets rescaled
+        if (layer_.setScale(g.getInternalContext().getPhysicalPixelScaleFactor())) {
+            to_update_xs_para_.signal();
         }
+        const auto bound = getLocalBounds().toFloat();
+        layer_.draw(g, bound.getWidth(), bound.getHeight());
     }
 
     void FFTPanel::resized() {
@@ -100,11 +69,11 @@ namespace zlpanel {
         to_update_ys_para_.signal();
     }
 
-    void FFTPanel::run(const juce::Thread& thread) {
-        runFFT(thread);
+    void FFTPanel::run(const juce::ThreadPoolJob& job) {
+        runFFT(job);
     }
 
-    void FFTPanel::runFFT(const juce::Thread& thread) {
+    void FFTPanel::runFFT(const juce::ThreadPoolJob& job) {
         juce::ScopedNoDenormals noDenormals;
         const auto pre_on = pre_ref_.load(std::memory_order::relaxed) > .5f;
         const auto post_on = post_ref_.load(std::memory_order::relaxed) > .5f;
@@ -112,12 +81,14 @@ namespace zlpanel {
         const auto coll_on = coll_ref_.load(std::memory_order::relaxed) > .5f;
         const std::array<bool, kNumSources> is_on{pre_on, post_on, side_on};
         auto& sender{p_ref_.getController().getAnalyzerSender()};
-        if (!sender.getLock().try_lock()) {
+        auto* generation = sender.tryAcquire();
+        if (generation == nullptr) {
             return;
         }
         // update sample rate
-        const auto sample_rate = sender.getSampleRate();
+        const auto sample_rate = generation->sample_rate;
         bool update_smooth{false};
+        bool is_changed{false};
         if (std::abs(c_sample_rate_ - sample_rate) > 0.1) {
             c_sample_rate_ = sample_rate;
             to_update_tilt_.signal();
@@ -146,13 +117,27 @@ namespace zlpanel {
                 processors_[kLowResolution].getFFTSize(),
                 processors_[kMiddleResolution].getFFTSize(),
                 processors_[kHighResolution].getFFTSize(), sample_rate);
-            tilter_.prepareSpectrum(frequencies_.size());
+            const auto low_size = processors_[kLowResolution].getFFTSize() / 2 + 1;
+            const auto middle_size = processors_[kMiddleResolution].getFFTSize() / 2 + 1;
+            const auto high_size = processors_[kHighResolution].getFFTSize() / 2 + 1;
+            plans_[0].prepare(frequencies_, {low_size, middle_size, high_size}, sample_rate);
+            plans_[0].setResolutionScales(noise_power_scales_);
+            plans_[1].prepare(frequencies_, {middle_size, middle_size, high_size}, sample_rate);
+            plans_[1].setResolutionScales({
+                noise_power_scales_[kMiddleResolution], noise_power_scales_[kMiddleResolution],
+                noise_power_scales_[kHighResolution]
+            });
             for (auto& decayer : decayers_) {
                 decayer.prepareSpectrum(frequencies_.size());
             }
 
             xs_.resize(frequencies_.size());
             ys_.resize(frequencies_.size());
+            ys_diff_.resize(frequencies_.size());
+            for (auto& previous_ys : previous_ys_) {
+                previous_ys.resize(frequencies_.size());
+                std::ranges::fill(previous_ys, 0.f);
+            }
 
             current_ps_.resize(frequencies_.size());
             coll_ps_.resize(frequencies_.size());
@@ -170,7 +155,7 @@ namespace zlpanel {
             to_update_ys_para_.signal();
         }
         // receiver pull data
-        auto& fifo{sender.getAbstractFIFO()};
+        auto& fifo{generation->abstract_fifo};
         auto num_read = fifo.getNumReady() / 4 * 3;
         if (num_read > history_size_) {
             (void)fifo.prepareToRead(num_read - history_size_);
@@ -178,14 +163,16 @@ namespace zlpanel {
             num_read = history_size_;
         }
         const auto range = fifo.prepareToRead(num_read);
+        bool is_input_active{false};
         for (size_t i = 0; i < kNumSources; i++) {
             if (is_on[i]) {
-                receivers_[i].pull(range, sender.getSampleFIFOs()[i]);
+                receivers_[i].pull(range, generation->sample_fifos[i]);
+                is_input_active = is_input_active || IdleTracker::hasSignal(range, generation->sample_fifos[i]);
             }
         }
         fifo.finishRead(num_read);
-        sender.getLock().unlock();
-        if (thread.threadShouldExit()) {
+        sender.release(generation);
+        if (job.shouldExit()) {
             return;
         }
         if (history_size_ <= 0) {
@@ -207,10 +194,12 @@ namespace zlpanel {
             to_update_tilt_.signal();
         }
         if (to_update_tilt_.check()) {
-            tilter_.setTiltSlope(
-                frequencies_,
-                zlstate::PFFTTilt::kSlopes[static_cast<size_t>(fft_tilt_idx)] +
-                spectrum_extra_tilt_slope_.load(std::memory_order::relaxed));
+            is_changed = true;
+            const auto tilt_slope = zlstate::PFFTTilt::kSlopes[static_cast<size_t>(fft_tilt_idx)] +
+                spectrum_extra_tilt_slope_.load(std::memory_order::relaxed);
+            for (auto& plan : plans_) {
+                plan.setTiltSlope(tilt_slope);
+            }
         }
         // update speed
         const auto fft_speed_idx = static_cast<int>(std::round(
@@ -219,8 +208,12 @@ namespace zlpanel {
             fft_speed_idx_ = fft_speed_idx;
             to_update_decay_.signal();
         }
+        const auto quality_level = quality_level_.load(std::memory_order::relaxed);
         if (to_update_decay_.check()) {
-            const auto refresh_rate = refresh_rate_.load(std::memory_order::relaxed);
+            is_changed = true;
+            // the analysis runs on every other frame from kHalfRate
+            const auto refresh_rate = refresh_rate_.load(std::memory_order::relaxed)
+                / (quality_level >= FrameGovernor::kHalfRate ? 2.f : 1.f);
             const auto decay_speed = zlstate::PFFTSpeed::kSpeeds[
                 static_cast<size_t>(fft_speed_idx_)] * spectrum_extra_decay_speed_.load(std::memory_order::relaxed);
             for (auto& decayer : decayers_) {
@@ -243,6 +236,7 @@ namespace zlpanel {
             update_smooth = true;
         }
         if (update_smooth) {
+            is_changed = true;
             if (fft_smooth_type_idx == 0) {
                 for (auto& smoother : smoothers_) {
                     smoother.setSmoothOCT(
@@ -258,6 +252,7 @@ namespace zlpanel {
         }
         // update xs para
         if (to_update_xs_para_.check()) {
+            is_changed = true;
             const auto fft_max = freq_helper::getFFTMax(sample_rate);
             c_width_ = width_.load(std::memory_order::relaxed) * kFFTSizeOverWidth;
             c_width_ *= static_cast<float>(std::log((sample_rate * .5 - 0.1) * 0.1) / std::log(fft_max * 0.1));
@@ -275,6 +270,7 @@ namespace zlpanel {
         }
         // update ys para
         if (to_update_ys_para_.check()) {
+            is_changed = true;
             c_height_ = height_.load(std::memory_order::relaxed);
             const auto font_size = font_size_.load(std::memory_order::relaxed);
             const auto bottom_area_height = getBottomAreaHeight(font_size);
@@ -290,30 +286,47 @@ namespace zlpanel {
         const auto fft_stereo = static_cast<zldsp::analyzer::StereoType>(std::round(
             stereo_ref_.load(std::memory_order::relaxed)));
         const auto fft_frozen = is_fft_frozen_.load(std::memory_order::relaxed);
+        // skip the analysis while the input is silent and the display has settled
+        const FrameState frame_state{
+            is_on, coll_on, fft_frozen, static_cast<int>(fft_stereo), quality_level,
+            static_cast<int>(std::round(coll_strength_ref_.load(std::memory_order::relaxed) * 1000.f))
+        };
+        if (frame_state != c_frame_state_) {
+            c_frame_state_ = frame_state;
+            is_changed = true;
+        }
+        if (!idle_tracker_.shouldCompute(is_input_active, is_changed)) {
+            return;
+        }
+        float max_y_change{0.f};
+        // skip the largest FFT from kSkipLargestFFT
+        const auto first_resolution = quality_level >= FrameGovernor::kSkipLargestFFT
+                                          ? kMiddleResolution
+                                          : kLowResolution;
         for (size_t i = 0; i < kNumSources; i++) {
             if (!is_on[i]) {
                 continue;
             }
-            for (size_t resolution = 0; resolution < kNumResolutions; ++resolution) {
+            for (size_t resolution = first_resolution; resolution < kNumResolutions; ++resolution) {
                 auto& resolution_spectrum = resolution_spectra_[i][resolution];
                 receivers_[i].forward(processors_[resolution], fft_stereo, resolution_spectrum);
-                zldsp::vector::multiply(resolution_spectrum.data(), noise_power_scales_[resolution],
-                                        resolution_spectrum.size());
                 smoothers_[resolution].smooth(resolution_spectrum);
             }
             auto& spectrum{spectra_[i]};
-            zldsp::analyzer::SpectrumBlender::blend(
-                spectrum, frequencies_,
-                resolution_spectra_[i][kLowResolution],
+            // blend, scale and tilt in one pass over the display grid
+            plans_[first_resolution == kLowResolution ? 0 : 1].process(spectrum, {
+                resolution_spectra_[i][first_resolution],
                 resolution_spectra_[i][kMiddleResolution],
-                resolution_spectra_[i][kHighResolution],
-                sample_rate);
+                resolution_spectra_[i][kHighResolution]
+            });
             zldsp::vector::sqr_mag_to_db(spectrum.data(), spectrum.size());
-            tilter_.tilt(std::span{spectrum.data(), spectrum.size()});
             decayers_[i].decay(std::span{spectrum.data(), spectrum.size()}, fft_frozen);
             zldsp::vector::fma(ys_.data(), spectrum.data(), y_k_, y_b_, num_point_);
+            zldsp::vector::sub(ys_diff_.data(), ys_.data(), previous_ys_[i].data(), num_point_);
+            max_y_change = std::max(max_y_change, zldsp::vector::max_abs_of(ys_diff_.data(), num_point_));
+            zldsp::vector::copy(previous_ys_[i].data(), ys_.data(), num_point_);
 
-            auto& path{paths_[i].getWriter()};
+            auto& path{paths_[i]};
             path.clear();
             PathMinimizer<5> minimizer{path};
             path.startNewSubPath(xs_.front() - .1f, c_height_ * 1.5f);
@@ -324,20 +337,18 @@ namespace zlpanel {
             minimizer.finish();
             path.lineTo(xs_[num_point_ - 1] + .1f, c_height_ * 1.5f);
             path.closeSubPath();
-            if (thread.threadShouldExit()) {
+            if (job.shouldExit()) {
                 return;
             }
         }
-        for (size_t i = 0; i < kNumSources; i++) {
-            if (is_on[i]) {
-                paths_[i].publish();
-            }
-        }
-        if (thread.threadShouldExit()) {
+        idle_tracker_.finishFrame(is_input_active, max_y_change);
+        if (job.shouldExit()) {
             return;
         }
         // update collision
-        if (coll_on && ((pre_on && post_on) || (side_on && post_on))) {
+        const auto draw_collision = coll_on && quality_level < FrameGovernor::kNoCollision
+            && ((pre_on && post_on) || (side_on && post_on));
+        if (draw_collision) {
             if (side_on) {
                 zldsp::analyzer::SpectrumCollision<float>::createGradientPs(
                     spectra_[1], spectra_[2],
@@ -347,24 +358,55 @@ namespace zlpanel {
                     spectra_[1], spectra_[0],
                     current_ps_, coll_ps_, coll_strength_ref_.load(std::memory_order::relaxed));
             }
-            if (thread.threadShouldExit()) {
+            if (job.shouldExit()) {
                 return;
             }
             const auto width = width_.load(std::memory_order::relaxed);
-            auto& gradient{gradient_.getWriter()};
+            auto& gradient{gradient_};
             gradient.clearColours();
             gradient.point1 = {0.f, 0.f};
             gradient.point2 = {width, 0.f};
             gradient.isRadial = false;
-            GradientMinimizer gradient_minimizer(gradient, collision_colour_);
+            GradientMinimizer gradient_minimizer(
+                gradient, juce::Colour(collision_colour_.load(std::memory_order::relaxed)));
             gradient_minimizer.start(0.f, 0.f);
             for (size_t i = 1; i < num_point_ - 1; ++i) {
                 gradient_minimizer.addColour(xs_[i] / width, coll_ps_[i]);
             }
             gradient_minimizer.addColour(xs_[num_point_ - 1] / width, coll_ps_[num_point_ - 1]);
             gradient_minimizer.finish();
-            gradient_.publish();
         }
+        renderLayer(is_on, draw_collision);
+    }
+
+    void FFTPanel::renderLayer(const std::array<bool, kNumSources>& is_on, const bool draw_collision) {
+        const auto width = width_.load(std::memory_order::relaxed);
+        const auto height = height_.load(std::memory_order::relaxed);
+        layer_.render(width, height, [&](juce::Graphics& g) {
+            std::array<juce::Colour, kNumSources> colours{};
+            for (size_t i = 0; i < kNumSources; ++i) {
+                colours[i] = juce::Colour(source_colours_[i].load(std::memory_order::relaxed));
+            }
+            if (is_on[0]) {
+                g.setColour(colours[0]);
+                g.fillPath(paths_[0]);
+            }
+            if (is_on[1]) {
+                const auto thickness = font_size_.load(std::memory_order::relaxed) * .2f;
+                g.setColour(colours[1].withAlpha(1.f));
+                g.strokePath(paths_[1], {thickness, juce::PathStrokeType::curved, juce::PathStrokeType::rounded});
+                g.setColour(colours[1]);
+                g.fillPath(paths_[1]);
+            }
+            if (is_on[2]) {
+                g.setColour(colours[2]);
+                g.fillPath(paths_[2]);
+            }
+            if (draw_collision && gradient_.getNumColours() >= 2) {
+                g.setGradientFill(gradient_);
+                g.fillRect(juce::Rectangle<float>(0.f, 0.f, width, height));
+            }
+        });
     }
 
     void FFTPanel::setRefreshRate(const double refresh_rate) {
@@ -372,7 +414,23 @@ namespace zlpanel {
         to_update_decay_.signal();
     }
 
+    void FFTPanel::setQualityLevel(const int level) {
+        quality_level_.store(level, std::memory_order::relaxed);
+        to_update_decay_.signal();
+    }
+
     void FFTPanel::lookAndFeelChanged() {
+        source_colours_[0].store(base_.getColourByIdx(zlgui::ColourIdx::kPreColour).getARGB(),
+                                 std::memory_order::relaxed);
+        source_colours_[1].store(base_.getColourByIdx(zlgui::ColourIdx::kPostColour).getARGB(),
+                                 std::memory_order::relaxed);
+        source_colours_[2].store(base_.getColourByIdx(zlgui::ColourIdx::kSideColour).getARGB(),
+                                 std::memory_order::relaxed);
+        collision_colour_.store(base_.getColourByIdx(zlgui::kCollisionColour).getARGB(),
+                                std::memory_order::relaxed);
+        // colours are baked into the layer, so it has to be rasterised again
+        to_update_ys_para_.signal();
+
         const auto extra_speed = base_.getFFTExtraSpeed();
         spectrum_extra_decay_speed_.store(extra_speed * extra_speed + 0.1f, std::memory_order::relaxed);
         to_update_decay_.signal();
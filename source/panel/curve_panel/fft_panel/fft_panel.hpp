@@ -15,10 +15,10 @@
 #include "../../multilingual/tooltip_helper.hpp"
 #include "../../../dsp/analyzer/fft_analyzer/fft_analyzer_receiver.hpp"
 #include "../../../dsp/analyzer/fft_analyzer/spectrum_smoother.hpp"
-#include "../../../dsp/analyzer/fft_analyzer/spectrum_tilter.hpp"
 #include "../../../dsp/analyzer/fft_analyzer/spectrum_decayer.hpp"
 #include "../../../dsp/analyzer/fft_analyzer/spectrum_collision.hpp"
 #include "../../../dsp/analyzer/fft_analyzer/spectrum_blender.hpp"
+#include "../../../dsp/analyzer/fft_analyzer/spectrum_plan.hpp"
 #include "../../../chore/thread/notifier.hpp"
 
 namespace zlpanel {
@@ -31,18 +31,34 @@ namespace zlpanel {
 
         void paint(juce::Graphics& g) override;
 
-        void run(const juce::Thread& thread);
+        void run(const juce::ThreadPoolJob& job);
 
         void resized() override;
 
         void setRefreshRate(double refresh_rate);
 
+        /**
+         * set the FrameGovernor quality level
+         * @param level
+         */
+        void setQualityLevel(int level);
+
     private:
         static constexpr size_t kNumSources = 3;
         static constexpr size_t kNumResolutions = 3;
         static constexpr size_t kLowResolution = 0;
         static constexpr size_t kMiddleResolution = 1;
         static constexpr size_t kHighResolution = 2;
+        struct FrameState {
+            std::array<bool, kNumSources> is_on{};
+            bool coll_on{false};
+            bool fft_frozen{false};
+            int fft_stereo{0};
+            int quality_level{0};
+            int coll_strength{0};
+
+            bool operator==(const FrameState&) const = default;
+        };
 
         PluginProcessor& p_ref_;
         zlgui::UIBase& base_;
@@ -72,8 +88,15 @@ namespace zlpanel {
         bool skip_next_repaint_{false};
 
         std::vector<float> xs_{}, ys_{};
+        std::vector<float> ys_diff_{};
+        std::array<std::vector<float>, kNumSources> previous_ys_{};
+        FrameState c_frame_state_{};
+        IdleTracker idle_tracker_;
         std::vector<float> frequencies_{};
-        std::array<TriBuffer<juce::Path>, kNumSources> paths_;
+        std::array<juce::Path, kNumSources> paths_;
+        // the spectra and the collision gradient are rasterised on the worker thread
+        ImageLayer layer_;
+        std::array<std::atomic<juce::uint32>, kNumSources> source_colours_{};
 
         double c_sample_rate_{0.0};
         int history_size_{0};
@@ -96,6 +119,8 @@ namespace zlpanel {
 
         std::atomic<bool> is_fft_frozen_{false};
 
+        std::atomic<int> quality_level_{FrameGovernor::kFull};
+
         std::array<zldsp::analyzer::FFTAnalyzerProcessor, kNumResolutions> processors_;
         std::array<zldsp::analyzer::FFTAnalyzerReceiver, kNumSources> receivers_{
             zldsp::analyzer::FFTAnalyzerReceiver{processors_[kLowResolution]},
@@ -103,7 +128,8 @@ namespace zlpanel {
             zldsp::analyzer::FFTAnalyzerReceiver{processors_[kLowResolution]}
         };
         std::array<zldsp::analyzer::SpectrumSmoother, kNumResolutions> smoothers_;
-        zldsp::analyzer::SpectrumTilter tilter_;
+        // the full plan and the plan which replaces the largest FFT with the middle one
+        std::array<zldsp::analyzer::SpectrumPlan, 2> plans_;
         std::array<zldsp::analyzer::SpectrumDecayer, kNumSources> decayers_;
 
         std::array<std::array<zldsp::vector::aligned_vector<float>, kNumResolutions>,
@@ -112,10 +138,12 @@ namespace zlpanel {
         std::array<float, kNumResolutions> noise_power_scales_{};
 
         zldsp::vector::aligned_vector<float> current_ps_{}, coll_ps_{};
-        TriBuffer<juce::ColourGradient> gradient_;
-        juce::Colour collision_colour_;
+        juce::ColourGradient gradient_;
+        std::atomic<juce::uint32> collision_colour_{};
+
+        void runFFT(const juce::ThreadPoolJob& job);
 
-        void runFFT(const juce::Thread& thread);
+        void renderLayer(const std::array<bool, kNumSources>& is_on, bool draw_collision);
 
         void lookAndFeelChanged() override;
 
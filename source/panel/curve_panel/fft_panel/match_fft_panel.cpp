@@ -19,7 +19,13 @@ namespace zlpanel {
         eq_max_db_idx_ref_(*p.parameters_NA_.getRawParameterValue(zlstate::PEQMaxDB::kID)),
         fft_smooth_oct_value_idx_ref_(*p.parameters_NA_.getRawParameterValue(zlstate::PFFTSmoothOCTValue::kID)),
         fft_smooth_erb_value_idx_ref_(*p.parameters_NA_.getRawParameterValue(zlstate::PFFTSmoothERBValue::kID)),
-        fft_smooth_type_idx_ref_(*p.parameters_NA_.getRawParameterValue(zlstate::PFFTSmoothType::kID)) {
+        fft_smooth_type_idx_ref_(*p.parameters_NA_.getRawParameterValue(zlstate::PFFTSmoothType::kID)),
+        match_task_("match", match_pool_,
+                    [this](const juce::ThreadPoolJob& job) { runMatch(job); }),
+        reference_analyzer_([this](const ReferenceAnalyzer::Result& result) {
+            reference_speed_ = result.speed;
+            loadFromPreset(result.freqs, result.dbs);
+        }) {
         for (auto& receiver : receivers_) {
             receiver.setON(true);
         }
@@ -28,9 +34,11 @@ namespace zlpanel {
             db.store(-1000.f, std::memory_order::relaxed);
         }
         std::ranges::fill(c_drawing_dbs_, -1000.f);
+        match_task_.start();
     }
 
     MatchFFTPanel::~MatchFFTPanel() {
+        match_task_.stop();
         p_ref_.getController().setMatchBypassON(false);
         stopTimer();
     }
@@ -51,7 +59,7 @@ namespace zlpanel {
                      {thickness * 1.5f, juce::PathStrokeType::curved, juce::PathStrokeType::rounded});
     }
 
-    void MatchFFTPanel::run(const juce::Thread& thread) {
+    void MatchFFTPanel::run(const juce::ThreadPoolJob& job) {
         if (to_reset_analyzer_.check()) {
             for (auto& accu : accumulators_) {
                 accu.reset();
@@ -61,12 +69,7 @@ namespace zlpanel {
             }
             to_update_drawing_.signal();
         }
-        if (match_phase_.load(std::memory_order::relaxed) == MatchPhase::kAnalyze) {
-            runAnalyze(thread);
-        } else {
-            runMatch(thread);
-            match_phase_.store(MatchPhase::kAnalyze, std::memory_order::release);
-        }
+        runAnalyze(job);
     }
 
     void MatchFFTPanel::resized() {
@@ -95,6 +98,33 @@ namespace zlpanel {
         to_update_preset_.signal();
     }
 
+    void MatchFFTPanel::loadFromFile(const juce::File& file) {
+        reference_speed_ = 0.0;
+        const auto smooth_type = static_cast<int>(std::round(
+            fft_smooth_type_idx_ref_.load(std::memory_order::relaxed)));
+        if (smooth_type == 0) {
+            const auto idx = static_cast<size_t>(std::round(
+                fft_smooth_oct_value_idx_ref_.load(std::memory_order::relaxed)));
+            reference_analyzer_.analyze(file, smooth_type, zlstate::PFFTSmoothOCTValue::kValues[idx]);
+        } else {
+            const auto idx = static_cast<size_t>(std::round(
+                fft_smooth_erb_value_idx_ref_.load(std::memory_order::relaxed)));
+            reference_analyzer_.analyze(file, smooth_type, zlstate::PFFTSmoothERBValue::kValues[idx]);
+        }
+    }
+
+    juce::String MatchFFTPanel::getReferenceWildcard() const {
+        return reference_analyzer_.getWildcard();
+    }
+
+    double MatchFFTPanel::getReferenceSpeed() const {
+        return reference_speed_;
+    }
+
+    bool MatchFFTPanel::isAnalyzingReference() const {
+        return reference_analyzer_.isAnalyzing();
+    }
+
     void MatchFFTPanel::saveToPreset(std::vector<float>& freqs, std::vector<float>& dbs) {
         {
             std::lock_guard lock{save_freq_mutex_};
@@ -133,23 +163,43 @@ namespace zlpanel {
 
     void MatchFFTPanel::setMatchPhase(const MatchPhase match_phase) {
         match_phase_.store(match_phase, std::memory_order::relaxed);
+        if (match_phase == MatchPhase::kMatch) {
+            to_cancel_match_.store(false, std::memory_order::relaxed);
+            match_progress_num_band_.store(0, std::memory_order::relaxed);
+            match_progress_mse_.store(0.0, std::memory_order::relaxed);
+            match_task_.trigger();
+        } else {
+            to_cancel_match_.store(true, std::memory_order::relaxed);
+        }
     }
 
     MatchFFTPanel::MatchPhase MatchFFTPanel::getMatchPhase() const {
         return match_phase_.load(std::memory_order::relaxed);
     }
 
+    void MatchFFTPanel::cancelMatch() {
+        to_cancel_match_.store(true, std::memory_order::relaxed);
+    }
+
+    MatchFFTPanel::MatchProgress MatchFFTPanel::getMatchProgress() const {
+        return {
+            match_progress_num_band_.load(std::memory_order::relaxed),
+            match_progress_mse_.load(std::memory_order::relaxed)
+        };
+    }
+
     void MatchFFTPanel::setMatchLimit(const float match_limit) {
         match_limit_.store(match_limit, std::memory_order::relaxed);
     }
 
-    void MatchFFTPanel::runAnalyze(const juce::Thread& thread) {
+    void MatchFFTPanel::runAnalyze(const juce::ThreadPoolJob& job) {
         juce::ScopedNoDenormals noDenormals;
         auto& sender{p_ref_.getController().getAnalyzerSender()};
-        if (!sender.getLock().try_lock()) {
+        auto* generation = sender.tryAcquire();
+        if (generation == nullptr) {
             return;
         }
-        const auto sample_rate = sender.getSampleRate();
+        const auto sample_rate = generation->sample_rate;
         bool update_smooth{false};
         if (std::abs(c_sample_rate_ - sample_rate) > 0.1) {
             c_sample_rate_ = sample_rate;
@@ -207,7 +257,7 @@ namespace zlpanel {
             to_update_target_curve_.signal();
         }
         // receiver pull data
-        auto& fifo{sender.getAbstractFIFO()};
+        auto& fifo{generation->abstract_fifo};
         auto num_read = fifo.getNumReady() / 4 * 3;
         if (num_read > fft_size_) {
             (void)fifo.prepareToRead(num_read - fft_size_);
@@ -215,11 +265,11 @@ namespace zlpanel {
             num_read = fft_size_;
         }
         const auto range = fifo.prepareToRead(num_read);
-        receivers_[0].pull(range, sender.getSampleFIFOs()[0]);
-        receivers_[1].pull(range, sender.getSampleFIFOs()[2]);
+        receivers_[0].pull(range, generation->sample_fifos[0]);
+        receivers_[1].pull(range, generation->sample_fifos[2]);
         fifo.finishRead(num_read);
-        sender.getLock().unlock();
-        if (thread.threadShouldExit()) {
+        sender.release(generation);
+        if (job.shouldExit()) {
             return;
         }
         if (fft_size_ <= 0) {
@@ -321,35 +371,71 @@ namespace zlpanel {
         }
         }
         processDiff();
-        if (thread.threadShouldExit()) {
+        if (job.shouldExit()) {
             return;
         }
         for (size_t i = 0; i < 3; i++) {
             paths_[i].publish();
         }
+        publishMatchInput();
+    }
+
+    void MatchFFTPanel::publishMatchInput() {
+        auto& match_input{match_input_.getWriter()};
+        match_input.freqs_.resize(freqs_.size());
+        std::copy(freqs_.begin(), freqs_.end(), match_input.freqs_.begin());
+        match_input.dbs_.resize(dbs_[0].size());
+        std::copy(dbs_[0].begin(), dbs_[0].end(), match_input.dbs_.begin());
+        match_input_.publish();
     }
 
-    void MatchFFTPanel::runMatch(const juce::Thread& thread) {
+    void MatchFFTPanel::runMatch(const juce::ThreadPoolJob& job) {
+        if (match_phase_.load(std::memory_order::relaxed) != MatchPhase::kMatch) {
+            return;
+        }
+        match_input_.pull();
+        const auto& match_input{match_input_.getReader()};
+        zldsp::vector::aligned_vector<float> freqs{match_input.freqs_};
         zldsp::vector::aligned_vector<float> diffs;
-        diffs.resize(dbs_[0].size());
-        zldsp::vector::multiply(diffs.data(), dbs_[0].data(), -1.f, dbs_[0].size());
+        diffs.resize(match_input.dbs_.size());
+        zldsp::vector::multiply(diffs.data(), match_input.dbs_.data(), -1.f, match_input.dbs_.size());
         const auto match_limit = match_limit_.load(std::memory_order::relaxed);
         zldsp::vector::clamp(diffs.data(), -match_limit, match_limit, diffs.size());
-        zlchore::eq_match::EqMatchOptimizer optimizer{
-            p_ref_.getAtomicSampleRate(),
-            freqs_,
-            diffs
-        };
-        auto& match_result{match_result_.getWriter()};
-        const auto num_band = optimizer.fit(
-            match_result.filter_paras_, zlp::kBandNum, [&thread]() {
-                return thread.threadShouldExit();
+        const auto sample_rate = p_ref_.getAtomicSampleRate();
+        if (to_reset_previous_match_.check() || std::abs(c_previous_sample_rate_ - sample_rate) > 0.1) {
+            c_previous_sample_rate_ = sample_rate;
+            c_previous_paras_.clear();
+        }
+        std::vector<zldsp::filter::FilterParameters> filter_paras;
+        size_t num_band{0};
+        if (!freqs.empty()) {
+            zlchore::eq_match::EqMatchOptimizer optimizer{
+                sample_rate,
+                freqs,
+                diffs
+            };
+            optimizer.setOnProgress([this](const std::span<const zldsp::filter::FilterParameters> paras,
+                                           const double mse) {
+                match_progress_num_band_.store(paras.size(), std::memory_order::relaxed);
+                match_progress_mse_.store(mse, std::memory_order::relaxed);
             });
-        if (thread.threadShouldExit()) {
+            // start from the previous solution so that small changes of the target only need a local refinement,
+            // the optimizer falls back to a cold fit when the target has moved too far
+            num_band = optimizer.refit(
+                filter_paras, c_previous_paras_, zlp::kBandNum, [this, &job]() {
+                    return job.shouldExit() || to_cancel_match_.load(std::memory_order::relaxed);
+                });
+        }
+        if (job.shouldExit()) {
             return;
         }
-        match_result.num_band_ = num_band;
+        // a cancelled match keeps the filters fitted so far
+        c_previous_paras_ = filter_paras;
+        auto& match_result{match_result_.getWriter()};
+        match_result.filter_paras_ = std::move(filter_paras);
+        match_result.num_band_ = std::min(num_band, match_result.filter_paras_.size());
         match_result_.publish();
+        match_phase_.store(MatchPhase::kAnalyze, std::memory_order::release);
         triggerAsyncUpdate();
     }
 
@@ -655,6 +741,7 @@ namespace zlpanel {
 
     void MatchFFTPanel::resetAnalyzer() {
         to_reset_analyzer_.signal();
+        to_reset_previous_match_.signal();
     }
 
     void MatchFFTPanel::updateMatchFilters(const MatchResult& match_result) {
@@ -20,6 +20,7 @@
 #include "../../../dsp/interpolation/interpolation.hpp"
 #include "../../../chore/eq_match/eq_match_optimizer.hpp"
 #include "../../../chore/thread/notifier.hpp"
+#include "reference_analyzer.hpp"
 
 namespace zlpanel {
     class MatchFFTPanel final : public juce::Component,
@@ -36,13 +37,18 @@ namespace zlpanel {
             kAnalyze, kMatch
         };
 
+        struct MatchProgress {
+            size_t num_band{0};
+            double mse{0.0};
+        };
+
         explicit MatchFFTPanel(PluginProcessor& p, zlgui::UIBase& base);
 
         ~MatchFFTPanel() override;
 
         void paint(juce::Graphics& g) override;
 
-        void run(const juce::Thread& thread);
+        void run(const juce::ThreadPoolJob& job);
 
         void resized() override;
 
@@ -50,6 +56,28 @@ namespace zlpanel {
 
         void saveToPreset(std::vector<float>& freqs, std::vector<float>& dbs);
 
+        /**
+         * analyse an audio file in the background and load its spectrum as the preset target
+         * @param file
+         */
+        void loadFromFile(const juce::File& file);
+
+        /**
+         * @return the wildcard of all audio files that can be loaded with loadFromFile()
+         */
+        juce::String getReferenceWildcard() const;
+
+        /**
+         * @return how many times faster than real time the last reference file was analysed
+         * zero until the analysis started by the last loadFromFile() finishes, message thread only
+         */
+        double getReferenceSpeed() const;
+
+        /**
+         * @return whether a reference file is being analysed
+         */
+        bool isAnalyzingReference() const;
+
         void setSideMode(SideMode mode);
 
         void setDiffDrawOn(bool is_on);
@@ -64,6 +92,16 @@ namespace zlpanel {
 
         MatchPhase getMatchPhase() const;
 
+        /**
+         * stop the running match, the filters fitted so far become the match result
+         */
+        void cancelMatch();
+
+        /**
+         * @return the number of fitted bands and the current MSE of the running (or the last) match
+         */
+        MatchProgress getMatchProgress() const;
+
         void setMatchLimit(float match_limit);
 
         void updateMatchNumBand(size_t num_band);
@@ -146,16 +184,32 @@ namespace zlpanel {
             size_t num_band_{0};
         };
 
+        struct MatchInput {
+            zldsp::vector::aligned_vector<float> freqs_;
+            zldsp::vector::aligned_vector<float> dbs_;
+        };
+
         std::atomic<MatchPhase> match_phase_{MatchPhase::kAnalyze};
+        // the latest diff published by the analyzer, so that the match job never touches the analyzer buffers
+        TriBuffer<MatchInput> match_input_;
         TriBuffer<MatchResult> match_result_;
+        std::atomic<bool> to_cancel_match_{false};
+        std::atomic<size_t> match_progress_num_band_{0};
+        std::atomic<double> match_progress_mse_{0.0};
+        // the last solution, used as the starting point of the next match, only accessed by the worker
+        std::vector<zldsp::filter::FilterParameters> c_previous_paras_;
+        double c_previous_sample_rate_{0.0};
+        zlchore::thread::Notifier to_reset_previous_match_{};
 
         std::atomic<float> match_limit_{12.f};
 
         zlchore::thread::Notifier to_reset_analyzer_{};
 
-        void runAnalyze(const juce::Thread& thread);
+        void runAnalyze(const juce::ThreadPoolJob& job);
+
+        void runMatch(const juce::ThreadPoolJob& job);
 
-        void runMatch(const juce::Thread& thread);
+        void publishMatchInput();
 
         void processMainFFT();
 
@@ -184,5 +238,18 @@ namespace zlpanel {
         void handleAsyncUpdate() override;
 
         void timerCallback() override;
+
+        // the match runs on its own thread, so that a long fit never holds a worker of the shared pool
+        // and the fft/response tasks keep running during a match
+        juce::ThreadPool match_pool_{
+            juce::ThreadPoolOptions{}
+            .withThreadName("zl_match")
+            .withNumberOfThreads(1)
+            .withDesiredThreadPriority(juce::Thread::Priority::low)
+        };
+        WorkerTask match_task_;
+
+        double reference_speed_{0.0};
+        ReferenceAnalyzer reference_analyzer_;
     };
 }
@@ -0,0 +1,166 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+#include "reference_analyzer.hpp"
+#include "../../../zlp/sample_rate_helper.hpp"
+
+namespace zlpanel {
+    ReferenceAnalyzer::ReferenceAnalyzer(OnFinish on_finish) :
+        on_finish_(std::move(on_finish)),
+        task_("reference", reference_pool_,
+              [this](const juce::ThreadPoolJob& job) { run(job); }) {
+        format_manager_.registerBasicFormats();
+        task_.start();
+    }
+
+    ReferenceAnalyzer::~ReferenceAnalyzer() {
+        request_id_.fetch_add(1, std::memory_order::relaxed);
+        task_.stop();
+        cancelPendingUpdate();
+    }
+
+    void ReferenceAnalyzer::analyze(const juce::File& file, const int smooth_type, const double smooth_value) {
+        {
+            std::lock_guard lock{request_mutex_};
+            request_file_ = file;
+            request_smooth_type_ = smooth_type;
+            request_smooth_value_ = smooth_value;
+        }
+        request_id_.fetch_add(1, std::memory_order::relaxed);
+        is_analyzing_.store(true, std::memory_order::relaxed);
+        task_.trigger();
+    }
+
+    void ReferenceAnalyzer::cancel() {
+        request_id_.fetch_add(1, std::memory_order::relaxed);
+        is_analyzing_.store(false, std::memory_order::relaxed);
+    }
+
+    void ReferenceAnalyzer::run(const juce::ThreadPoolJob& job) {
+        juce::ScopedNoDenormals no_denormals;
+        const auto request_id = request_id_.load(std::memory_order::relaxed);
+        const auto should_return = [&]() {
+            return job.shouldExit() || request_id_.load(std::memory_order::relaxed) != request_id;
+        };
+        juce::File file;
+        int smooth_type;
+        double smooth_value;
+        {
+            std::lock_guard lock{request_mutex_};
+            file = request_file_;
+            smooth_type = request_smooth_type_;
+            smooth_value = request_smooth_value_;
+        }
+        const std::unique_ptr<juce::AudioFormatReader> reader{format_manager_.createReaderFor(file)};
+        if (reader == nullptr || reader->sampleRate <= 0.0 || reader->lengthInSamples <= 0
+            || reader->numChannels == 0) {
+            if (!should_return()) {
+                is_analyzing_.store(false, std::memory_order::relaxed);
+            }
+            return;
+        }
+        const auto start_time = std::chrono::steady_clock::now();
+        // prepare the same pipeline as the match analyzer, at the sample rate of the file
+        const auto sample_rate = reader->sampleRate;
+        const auto fft_order = static_cast<int>(zlp::getScaledOrder(sample_rate, 12));
+        processor_.prepare(fft_order);
+        const auto fft_size = processor_.getFFTSize();
+        receiver_.setON(true);
+        receiver_.prepare(2);
+        accumulator_.prepare(fft_size);
+        smoother_.prepare(fft_size);
+        if (smooth_type == 0) {
+            smoother_.setSmoothOCT(smooth_value);
+        } else {
+            smoother_.setSmoothERB(sample_rate, smooth_value);
+        }
+        tilter_.prepare(fft_size);
+        tilter_.setTiltSlope(sample_rate, 4.5);
+        // decode one hop at a time, mono files feed both channels like a mono side-chain does
+        const auto hop_size = fft_size / 4;
+        const auto num_file_channels = static_cast<int>(std::min(reader->numChannels, 2u));
+        juce::AudioBuffer<float> buffer(num_file_channels, static_cast<int>(hop_size));
+        std::vector<std::vector<float>> samples(2, std::vector<float>(hop_size, 0.f));
+        auto& spectrum{receiver_.getAbsSqrFFTBuffer()};
+        size_t num_frames = 0;
+        juce::int64 position = 0;
+        while (position < reader->lengthInSamples) {
+            if (should_return()) {
+                return;
+            }
+            const auto num_samples = static_cast<int>(std::min(
+                static_cast<juce::int64>(hop_size), reader->lengthInSamples - position));
+            if (!reader->read(&buffer, 0, num_samples, position, true, true)) {
+                break;
+            }
+            for (size_t chan = 0; chan < 2; ++chan) {
+                const auto* src = buffer.getReadPointer(std::min(static_cast<int>(chan), num_file_channels - 1));
+                std::copy(src, src + num_samples, samples[chan].begin());
+            }
+            receiver_.pull({0, num_samples, 0, 0}, samples);
+            position += num_samples;
+            // skip the frames which are not filled yet, unless the file is shorter than one frame
+            if (position < static_cast<juce::int64>(fft_size) && position < reader->lengthInSamples) {
+                continue;
+            }
+            receiver_.forward(zldsp::analyzer::StereoType::kStereo);
+            accumulator_.process(spectrum);
+            num_frames += 1;
+        }
+        if (num_frames == 0 || should_return()) {
+            if (!should_return()) {
+                is_analyzing_.store(false, std::memory_order::relaxed);
+            }
+            return;
+        }
+        // the accumulator leaves the average spectrum in the buffer
+        smoother_.smooth(spectrum);
+        zldsp::vector::aligned_vector<float> raw_freqs(spectrum.size()), raw_dbs(spectrum.size());
+        zldsp::vector::sqr_mag_to_db(raw_dbs.data(), spectrum.data(), spectrum.size());
+        tilter_.tilt(std::span{raw_dbs.data(), raw_dbs.size()});
+        const double multiplier = sample_rate * 0.5 / static_cast<double>(raw_freqs.size() - 1);
+        for (size_t i = 0; i < raw_freqs.size(); ++i) {
+            raw_freqs[i] = static_cast<float>(static_cast<double>(i) * multiplier);
+        }
+        auto& result{result_.getWriter()};
+        result.freqs.resize(kNumPoints);
+        result.dbs.resize(kNumPoints);
+        {
+            constexpr double start_freq = 10.0;
+            const auto fft_max = freq_helper::getFFTMax(sample_rate);
+            const double freq_multiplier = std::pow(fft_max / start_freq, 1.0 / (kNumPoints - 1));
+            double current_freq = start_freq;
+            for (size_t i = 0; i < kNumPoints - 1; ++i) {
+                result.freqs[i] = static_cast<float>(current_freq);
+                current_freq *= freq_multiplier;
+            }
+            result.freqs.back() = static_cast<float>(fft_max - 0.1);
+        }
+        zldsp::interpolation::SeqMakima<float> interpolator{
+            raw_freqs.data(), raw_dbs.data(), raw_freqs.size(), 0.f, 0.f};
+        interpolator.prepare();
+        interpolator.eval(result.freqs.data(), result.dbs.data(), kNumPoints);
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
+        const auto duration = static_cast<double>(reader->lengthInSamples) / sample_rate;
+        result.speed = duration / std::max(elapsed.count(), 1e-9);
+        if (should_return()) {
+            return;
+        }
+        result_.publish();
+        is_analyzing_.store(false, std::memory_order::relaxed);
+        triggerAsyncUpdate();
+    }
+
+    void ReferenceAnalyzer::handleAsyncUpdate() {
+        result_.pull();
+        if (on_finish_) {
+            on_finish_(result_.getReader());
+        }
+    }
+}
@@ -0,0 +1,105 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <juce_audio_formats/juce_audio_formats.h>
+
+#include "../../helper/helper.hpp"
+#include "../../../dsp/analyzer/fft_analyzer/fft_analyzer_receiver.hpp"
+#include "../../../dsp/analyzer/fft_analyzer/spectrum_smoother.hpp"
+#include "../../../dsp/analyzer/fft_analyzer/spectrum_tilter.hpp"
+#include "../../../dsp/analyzer/fft_analyzer/spectrum_accumulator.hpp"
+#include "../../../dsp/interpolation/interpolation.hpp"
+
+namespace zlpanel {
+    /**
+     * analyse an audio file as fast as possible on the shared worker pool and turn it into a target curve
+     * the file is decoded in chunks of one hop, so the memory does not grow with the length of the file
+     * the spectrum goes through the same window, accumulator, smoother and tilter as the match analyzer
+     */
+    class ReferenceAnalyzer final : private juce::AsyncUpdater {
+    public:
+        static constexpr size_t kNumPoints = 128;
+
+        struct Result {
+            std::vector<float> freqs;
+            std::vector<float> dbs;
+            // the number of analysed seconds per second of analysis
+            double speed{0.0};
+        };
+
+        using OnFinish = std::function<void(const Result&)>;
+
+        /**
+         * @param on_finish called on the message thread when an analysis finishes
+         */
+        explicit ReferenceAnalyzer(OnFinish on_finish);
+
+        ~ReferenceAnalyzer() override;
+
+        /**
+         * start analysing the file, a running analysis is cancelled, must be called on the message thread
+         * @param file
+         * @param smooth_type 0 for octave smoothing, 1 for ERB smoothing
+         * @param smooth_value the octave or ERB width
+         */
+        void analyze(const juce::File& file, int smooth_type, double smooth_value);
+
+        /**
+         * cancel the running analysis, must be called on the message thread
+         */
+        void cancel();
+
+        [[nodiscard]] bool isAnalyzing() const {
+            return is_analyzing_.load(std::memory_order::relaxed);
+        }
+
+        /**
+         * @return the wildcard of all supported audio files, e.g. "*.wav;*.flac"
+         */
+        juce::String getWildcard() const {
+            return format_manager_.getWildcardForAllFormats();
+        }
+
+    private:
+        OnFinish on_finish_;
+        juce::AudioFormatManager format_manager_;
+
+        std::mutex request_mutex_;
+        juce::File request_file_;
+        int request_smooth_type_{0};
+        double request_smooth_value_{1.0};
+        // incremented by every request and cancellation, a running analysis stops once it is outdated
+        std::atomic<uint64_t> request_id_{0};
+        std::atomic<bool> is_analyzing_{false};
+
+        TriBuffer<Result> result_;
+
+        zldsp::analyzer::FFTAnalyzerProcessor processor_;
+        zldsp::analyzer::FFTAnalyzerReceiver receiver_{processor_};
+        zldsp::analyzer::SpectrumAccumulator accumulator_;
+        zldsp::analyzer::SpectrumSmoother smoother_;
+        zldsp::analyzer::SpectrumTilter tilter_;
+
+        void run(const juce::ThreadPoolJob& job);
+
+        void handleAsyncUpdate() override;
+
+        // the decode and the analysis of a file take seconds, so they run on their own thread
+        // instead of holding a worker of the shared pool, like the match of MatchFFTPanel
+        juce::ThreadPool reference_pool_{
+            juce::ThreadPoolOptions{}
+            .withThreadName("zl_reference")
+            .withNumberOfThreads(1)
+            .withDesiredThreadPriority(juce::Thread::Priority::low)
+        };
+        WorkerTask task_;
+    };
+}
@@ -26,25 +26,25 @@ namespace zlpanel {
                       tooltip_helper.getToolTipText(multilingual::kGainScale), 1.25f),
         scale_attach_(scale_slider_.getSlider1(), p.parameters_,
                       zlp::PGainScale::kID, updater_),
-        sgc_drawable_(juce::Drawable::createFromImageData(BinaryData::dline_s_svg,
-                                                          BinaryData::dline_s_svgSize)),
-        sgc_button_(base, sgc_drawable_.get(), sgc_drawable_.get(),
+        sgc_drawable_(base.getSharedDrawable(BinaryData::dline_s_svg,
+                                             BinaryData::dline_s_svgSize)),
+        sgc_button_(base, sgc_drawable_, sgc_drawable_,
                     tooltip_helper.getToolTipText(multilingual::kStaticGC)),
         sgc_attach_(sgc_button_.getButton(), p.parameters_,
                     zlp::PStaticGain::kID, updater_),
-        lm_drawable_(juce::Drawable::createFromImageData(BinaryData::dline_l_svg,
-                                                         BinaryData::dline_l_svgSize)),
-        lm_button_(base, lm_drawable_.get(), lm_drawable_.get(),
+        lm_drawable_(base.getSharedDrawable(BinaryData::dline_l_svg,
+                                            BinaryData::dline_l_svgSize)),
+        lm_button_(base, lm_drawable_, lm_drawable_,
                    tooltip_helper.getToolTipText(multilingual::kLoudnessGC)),
-        agc_drawable_(juce::Drawable::createFromImageData(BinaryData::dline_a_svg,
-                                                          BinaryData::dline_a_svgSize)),
-        agc_button_(base, agc_drawable_.get(), agc_drawable_.get(),
+        agc_drawable_(base.getSharedDrawable(BinaryData::dline_a_svg,
+                                             BinaryData::dline_a_svgSize)),
+        agc_button_(base, agc_drawable_, agc_drawable_,
                     tooltip_helper.getToolTipText(multilingual::kAutoGC)),
         agc_attach_(agc_button_.getButton(), p.parameters_,
                     zlp::PAutoGain::kID, updater_),
-        phase_drawable_(juce::Drawable::createFromImageData(BinaryData::phase_svg,
-                                                            BinaryData::phase_svgSize)),
-        phase_button_(base, phase_drawable_.get(), phase_drawable_.get(),
+        phase_drawable_(base.getSharedDrawable(BinaryData::phase_svg,
+                                               BinaryData::phase_svgSize)),
+        phase_button_(base, phase_drawable_, phase_drawable_,
                       tooltip_helper.getToolTipText(multilingual::kPhaseFlip)),
         phase_attach_(phase_button_.getButton(), p.parameters_,
                       zlp::PPhaseFlip::kID, updater_),
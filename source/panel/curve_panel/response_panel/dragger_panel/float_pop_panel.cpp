@@ -15,16 +15,16 @@ namespace zlpanel {
                                  const multilingual::TooltipHelper& tooltip_helper) :
         p_ref_(p), base_(base), updater_(),
         control_background_(base, .25f),
-        bypass_drawable_(juce::Drawable::createFromImageData(BinaryData::bypass_svg,
-                                                             BinaryData::bypass_svgSize)),
-        bypass_button_(base, bypass_drawable_.get(), bypass_drawable_.get(),
+        bypass_drawable_(base.getSharedDrawable(BinaryData::bypass_svg,
+                                                BinaryData::bypass_svgSize)),
+        bypass_button_(base, bypass_drawable_, bypass_drawable_,
                        tooltip_helper.getToolTipText(multilingual::kBandBypass)),
-        solo_drawable_(juce::Drawable::createFromImageData(BinaryData::solo_svg, BinaryData::solo_svgSize)),
-        solo_button_(base, solo_drawable_.get(), solo_drawable_.get(),
+        solo_drawable_(base.getSharedDrawable(BinaryData::solo_svg, BinaryData::solo_svgSize)),
+        solo_button_(base, solo_drawable_, solo_drawable_,
                      tooltip_helper.getToolTipText(multilingual::kBandSolo)),
-        close_drawable_(juce::Drawable::createFromImageData(BinaryData::trash_svg,
-                                                            BinaryData::trash_svgSize)),
-        close_button_(base, close_drawable_.get(), nullptr),
+        close_drawable_(base.getSharedDrawable(BinaryData::trash_svg,
+                                               BinaryData::trash_svgSize)),
+        close_button_(base, close_drawable_, nullptr),
         ftype_box_([]() -> std::vector<std::unique_ptr<juce::Drawable>> {
             std::vector<std::unique_ptr<juce::Drawable>> icons;
             icons.emplace_back(
@@ -13,7 +13,6 @@ namespace zlpanel {
     ResponsePanel::ResponsePanel(PluginProcessor& p,
                                  zlgui::UIBase& base,
                                  const multilingual::TooltipHelper& tooltip_helper) :
-        Thread("response"),
         p_ref_(p), base_(base),
         gain_scale_(*p.parameters_.getRawParameterValue(zlp::PGainScale::kID)),
         single_panel_(p, base, message_not_off_indices_),
@@ -35,15 +34,19 @@ namespace zlpanel {
 
         xs_.resize(kNumPoints);
         ws_.resize(kNumPoints);
+        coarse_ws_.resize(kNumCoarsePoints);
         for (size_t i = 0; i < zlp::kBandNum; ++i) {
+            coarse_mags_[i].resize(kNumCoarsePoints);
             base_mags_[i].resize(kNumPoints);
             target_mags_[i].resize(kNumPoints);
             dynamic_mags_[i].resize(kNumPoints);
+            summed_mags_[i].resize(kNumPoints);
         }
         for (size_t i = 0; i < 5; ++i) {
             sum_mags_[i].resize(kNumPoints);
             on_lr_indices_[i].reserve(zlp::kBandNum);
         }
+        std::ranges::fill(to_rebuild_sum_flags_, true);
         addAndMakeVisible(single_panel_);
         addAndMakeVisible(sum_panel_);
         addAndMakeVisible(dragger_panel_);
@@ -218,50 +221,52 @@ namespace zlpanel {
         dragger_panel_.updateSampleRate(sample_rate);
     }
 
-    void ResponsePanel::run() {
-        while (!threadShouldExit()) {
-            const auto flag = wait(-1);
-            juce::ignoreUnused(flag);
-            if (threadShouldExit()) {
-                break;
-            }
-            updateCurveParas();
-            if (threadShouldExit()) {
-                break;
-            }
-            if (!updateCurveMags()) {
-                break;
+    void ResponsePanel::run(const juce::ThreadPoolJob& job) {
+        updateCurveParas();
+        if (job.shouldExit()) {
+            return;
+        }
+        if (!updateCurveMags(job)) {
+            return;
+        }
+        for (size_t band = 0; band < zlp::kBandNum; ++band) {
+            single_panel_.run(band, c_filter_status_[band],
+                              to_update_base_y_flags_[band],
+                              to_update_target_y_flags_[band],
+                              xs_, c_k_, c_b_,
+                              base_mags_[band], target_mags_[band],
+                              points_[band][0].load(std::memory_order::relaxed),
+                              points_[band][3].load(std::memory_order::relaxed),
+                              points_[band][4].load(std::memory_order::relaxed),
+                              points_[band][1].load(std::memory_order::relaxed),
+                              points_[band][2].load(std::memory_order::relaxed),
+                              to_update_side_y_flags_[band],
+                              side_points_[band][1].load(std::memory_order::relaxed),
+                              side_points_[band][2].load(std::memory_order::relaxed),
+                              ideal_[band].getParas().filter_type == zldsp::filter::kAllPass,
+                              ideal_[band].getParas().order == 1);
+            if (job.shouldExit()) {
+                return;
             }
-            for (size_t band = 0; band < zlp::kBandNum; ++band) {
-                single_panel_.run(band, c_filter_status_[band],
-                                  to_update_base_y_flags_[band],
-                                  to_update_target_y_flags_[band],
-                                  xs_, c_k_, c_b_,
-                                  base_mags_[band], target_mags_[band],
-                                  points_[band][0].load(std::memory_order::relaxed),
-                                  points_[band][3].load(std::memory_order::relaxed),
-                                  points_[band][4].load(std::memory_order::relaxed),
-                                  points_[band][1].load(std::memory_order::relaxed),
-                                  points_[band][2].load(std::memory_order::relaxed),
-                                  to_update_side_y_flags_[band],
-                                  side_points_[band][1].load(std::memory_order::relaxed),
-                                  side_points_[band][2].load(std::memory_order::relaxed),
-                                  ideal_[band].getParas().filter_type == zldsp::filter::kAllPass,
-                                  ideal_[band].getParas().order == 1);
-                if (threadShouldExit()) {
-                    break;
-                }
+        }
+        for (size_t lr = 0; lr < 5; ++lr) {
+            if (to_update_lr_flags_[lr]) {
+                updateSumMags(lr);
             }
-            for (size_t lr = 0; lr < 5; ++lr) {
-                sum_panel_.run(lr, to_update_lr_flags_[lr], is_lr_not_off_flags_[lr],
-                               on_lr_indices_[lr],
-                               xs_, c_k_, c_b_,
-                               dynamic_mags_);
-                if (threadShouldExit()) {
-                    break;
-                }
+            sum_panel_.run(lr, to_update_lr_flags_[lr], is_lr_not_off_flags_[lr],
+                           !on_lr_indices_[lr].empty(),
+                           xs_, c_k_, c_b_,
+                           sum_mags_[lr]);
+            if (job.shouldExit()) {
+                return;
             }
         }
+        // everything is drawn, the next frame only does work for new changes
+        std::ranges::fill(to_update_base_y_flags_, false);
+        std::ranges::fill(to_update_target_y_flags_, false);
+        std::ranges::fill(to_update_side_y_flags_, false);
+        std::ranges::fill(to_update_dynamic_flags_, false);
+        std::ranges::fill(to_update_lr_flags_, false);
     }
 
     void ResponsePanel::parameterChanged(const juce::String& parameter_ID, const float value) {
@@ -355,8 +360,9 @@ namespace zlpanel {
                 if (c_dynamic_ons_[band] != dynamic_on) {
                     c_dynamic_ons_[band] = dynamic_ons_[band].load(std::memory_order::relaxed);
                     to_update_lr_flags_[static_cast<size_t>(c_lr_modes_[band])] = true;
+                    to_update_dynamic_flags_[band] = true;
                     if (!dynamic_on) {
-                        dynamic_mags_[band] = base_mags_[band];
+                        copyBaseToDynamicMags(band);
                     }
                 }
             }
@@ -382,6 +388,8 @@ namespace zlpanel {
                     is_lr_not_off_flags_[static_cast<size_t>(lr_mode)] = true;
                 }
             }
+            // the members of the sums may have changed
+            std::ranges::fill(to_rebuild_sum_flags_, true);
             message_to_update_panels_.signal();
         }
         // update sample rate
@@ -402,6 +410,17 @@ namespace zlpanel {
             for (size_t i = 0; i < kNumPoints; ++i) {
                 ws_[i] = static_cast<float>(std::exp(interval_log_value * static_cast<double>(i)) * freq_scale);
             }
+            for (size_t i = 0; i < kNumCoarsePoints; ++i) {
+                coarse_ws_[i] = ws_[i * kCoarseStep];
+            }
+            batch_.prepare(ws_);
+            coarse_batch_.prepare(coarse_ws_);
+            // all responses are evaluated at new frequencies
+            for (auto* fingerprints : {&base_fingerprints_, &target_fingerprints_, &dynamic_fingerprints_}) {
+                for (auto& fingerprint : *fingerprints) {
+                    fingerprint.is_valid = false;
+                }
+            }
             std::fill(to_update_base_y_flags_.begin(), to_update_base_y_flags_.end(), true);
         }
         // update width & xs
@@ -431,35 +450,58 @@ namespace zlpanel {
             c_b_ = h1;
             std::fill(to_update_base_y_flags_.begin(), to_update_base_y_flags_.end(), true);
         }
+        // the dynamic responses are evaluated on a different grid after a quality change
+        if (const auto quality_level = quality_level_.load(std::memory_order::relaxed);
+            quality_level != c_quality_level_) {
+            c_quality_level_ = quality_level;
+            std::ranges::fill(to_update_dynamic_flags_, true);
+        }
         // update db update flags
         for (size_t band = 0; band < zlp::kBandNum; ++band) {
+            // the target fill is drawn on top of the base path, so they are redrawn together
+            const auto to_update_target = to_update_target_gain_flags_[band].check();
             to_update_base_y_flags_[band] = to_update_base_y_flags_[band]
-                || to_update_empty_flags_[band].check();
-            to_update_target_y_flags_[band] = to_update_base_y_flags_[band]
-                || to_update_target_gain_flags_[band].check();
-            to_update_side_y_flags_[band] = to_update_base_y_flags_[band]
+                || to_update_empty_flags_[band].check() || to_update_target;
+            to_update_target_y_flags_[band] = to_update_base_y_flags_[band];
+            to_update_side_y_flags_[band] = to_update_side_y_flags_[band] || to_update_base_y_flags_[band]
                 || to_update_side_empty_flags_[band].check();
+            // only recompute a dynamic response when its gain has moved
+            if (c_dynamic_ons_[band]) {
+                const auto current_gain = p_ref_.getController().getCurrentGain(band);
+                if (to_update_base_y_flags_[band] || std::abs(current_gain - c_dynamic_gains_[band]) > 1e-4) {
+                    c_dynamic_gains_[band] = current_gain;
+                    to_update_dynamic_flags_[band] = true;
+                }
+            }
             const auto lr = c_lr_modes_[band];
             to_update_lr_flags_[static_cast<size_t>(lr)] = to_update_lr_flags_[static_cast<size_t>(lr)]
-                || to_update_base_y_flags_[band] || c_dynamic_ons_[band];
+                || to_update_base_y_flags_[band] || to_update_dynamic_flags_[band];
         }
     }
 
-    bool ResponsePanel::updateCurveMags() {
+    bool ResponsePanel::updateCurveMags(const juce::ThreadPoolJob& job) {
+        const auto reduce_points = c_quality_level_ >= FrameGovernor::kReducedPoints;
+        // collect all curves which have to be evaluated, then evaluate them in one pass over each grid
+        batch_.clear();
+        coarse_batch_.clear();
+        std::array<bool, zlp::kBandNum> base_pending{}, target_pending{}, dynamic_pending{};
         for (size_t band = 0; band < zlp::kBandNum; ++band) {
             if (c_filter_status_[band] != zlp::FilterStatus::kOff) {
                 if (to_update_base_y_flags_[band]) {
                     auto para = empty_[band].getParas();
                     para.freq = std::min(para.freq, c_slider_max_);
-                    ideal_[band].forceUpdate(para);
-                    ideal_[band].updateMagnitudeSquare(ws_, base_mags_[band]);
-                    zldsp::vector::sqr_mag_to_db(base_mags_[band].data(), base_mags_[band].size());
-                    if (!c_dynamic_ons_[band]) {
-                        dynamic_mags_[band] = base_mags_[band];
+                    // bound or scale changes only move the curve, the magnitudes stay the same
+                    if (const CurveFingerprint fingerprint{para, false, true};
+                        fingerprint != base_fingerprints_[band]) {
+                        ideal_[band].forceUpdate(para);
+                        batch_.addMagnitudeSquare(ideal_[band], base_mags_[band]);
+                        const auto center_w = para.freq * (2.0 * std::numbers::pi / c_sample_rate_);
+                        center_dbs_[band] = zldsp::chore::squareGainToDecibels(
+                            ideal_[band].getCenterMagnitudeSquare(static_cast<float>(center_w)));
+                        base_fingerprints_[band] = fingerprint;
+                        base_pending[band] = true;
                     }
-                    const auto center_w = para.freq * (2.0 * std::numbers::pi / c_sample_rate_);
-                    const float center_square_magnitude = zldsp::chore::squareGainToDecibels(
-                        ideal_[band].getCenterMagnitudeSquare(static_cast<float>(center_w)));
+                    const float center_square_magnitude = center_dbs_[band];
                     const auto [left_x, center_x, right_x] = getLeftCenterRightX(para);
 
                     points_[band][0].store(static_cast<float>(center_x), std::memory_order::relaxed);
@@ -469,25 +511,23 @@ namespace zlpanel {
                     para.gain = original_base_gains_[band].load(std::memory_order::relaxed);
                     points_[band][4].store(c_k_ * getButtonMag(para) + c_b_, std::memory_order::relaxed);
 
-                    if (threadShouldExit()) {
-                        return false;
-                    }
                     message_to_update_draggers_[band].signal();
                     message_to_update_draggers_total_.signal();
                 }
                 if (to_update_target_y_flags_[band]) {
-                    const auto target_gain = target_gains_[band].load(std::memory_order::relaxed);
-                    ideal_[band].setGain(target_gain);
-                    ideal_[band].updateCoeffs();
-                    ideal_[band].updateMagnitudeSquare(ws_, target_mags_[band]);
-                    zldsp::vector::sqr_mag_to_db(target_mags_[band].data(), target_mags_[band].size());
-                    auto para = ideal_[band].getParas();
+                    auto para = base_fingerprints_[band].para;
+                    para.gain = static_cast<double>(target_gains_[band].load(std::memory_order::relaxed));
+                    if (const CurveFingerprint fingerprint{para, false, true};
+                        fingerprint != target_fingerprints_[band]) {
+                        ideal_[band].setGain(para.gain);
+                        ideal_[band].updateCoeffs();
+                        batch_.addMagnitudeSquare(ideal_[band], target_mags_[band]);
+                        target_fingerprints_[band] = fingerprint;
+                        target_pending[band] = true;
+                    }
                     para.gain = original_target_gains_[band].load(std::memory_order::relaxed);
                     points_[band][5].store(c_k_ * getButtonMag(para) + c_b_, std::memory_order::relaxed);
 
-                    if (threadShouldExit()) {
-                        return false;
-                    }
                     message_to_update_target_dragger_.signal();
                     message_to_update_draggers_total_.signal();
                 }
@@ -509,20 +549,108 @@ namespace zlpanel {
                     message_to_update_side_dragger_.signal();
                     message_to_update_draggers_total_.signal();
                 }
-                if (c_dynamic_ons_[band]) {
-                    ideal_[band].setGain(p_ref_.getController().getCurrentGain(band));
-                    ideal_[band].updateCoeffs();
-                    ideal_[band].updateMagnitudeSquare(ws_, dynamic_mags_[band]);
-                    zldsp::vector::sqr_mag_to_db(dynamic_mags_[band].data(), dynamic_mags_[band].size());
-                    if (threadShouldExit()) {
-                        return false;
+                if (c_dynamic_ons_[band] && to_update_dynamic_flags_[band]) {
+                    auto para = base_fingerprints_[band].para;
+                    para.gain = c_dynamic_gains_[band];
+                    if (const CurveFingerprint fingerprint{para, reduce_points, true};
+                        fingerprint != dynamic_fingerprints_[band]) {
+                        ideal_[band].setGain(para.gain);
+                        ideal_[band].updateCoeffs();
+                        if (reduce_points) {
+                            coarse_batch_.addMagnitudeSquare(ideal_[band], coarse_mags_[band]);
+                        } else {
+                            batch_.addMagnitudeSquare(ideal_[band], dynamic_mags_[band]);
+                        }
+                        dynamic_fingerprints_[band] = fingerprint;
+                        dynamic_pending[band] = true;
                     }
                 }
             } else {
                 points_[band][4].store(-10000.f, std::memory_order::relaxed);
             }
         }
-        return true;
+        batch_.process();
+        coarse_batch_.process();
+        for (size_t band = 0; band < zlp::kBandNum; ++band) {
+            if (base_pending[band]) {
+                zldsp::vector::sqr_mag_to_db(base_mags_[band].data(), base_mags_[band].size());
+                if (!c_dynamic_ons_[band]) {
+                    copyBaseToDynamicMags(band);
+                }
+            }
+            if (target_pending[band]) {
+                zldsp::vector::sqr_mag_to_db(target_mags_[band].data(), target_mags_[band].size());
+            }
+            if (dynamic_pending[band]) {
+                if (reduce_points) {
+                    zldsp::vector::sqr_mag_to_db(coarse_mags_[band].data(), coarse_mags_[band].size());
+                    upsampleCoarseMags(coarse_mags_[band], dynamic_mags_[band]);
+                } else {
+                    zldsp::vector::sqr_mag_to_db(dynamic_mags_[band].data(), dynamic_mags_[band].size());
+                }
+                to_update_sum_flags_[band] = true;
+            }
+        }
+        return !job.shouldExit();
+    }
+
+    void ResponsePanel::copyBaseToDynamicMags(const size_t band) {
+        dynamic_mags_[band] = base_mags_[band];
+        dynamic_fingerprints_[band].is_valid = false;
+        to_update_sum_flags_[band] = true;
+    }
+
+    void ResponsePanel::updateSumMags(const size_t lr) {
+        auto& sum_mags{sum_mags_[lr]};
+        const auto& on_indices{on_lr_indices_[lr]};
+        sum_update_counts_[lr] += 1;
+        if (to_rebuild_sum_flags_[lr] || sum_update_counts_[lr] >= kFullSumInterval) {
+            to_rebuild_sum_flags_[lr] = false;
+            sum_update_counts_[lr] = 0;
+            std::ranges::fill(sum_mags, 0.f);
+            for (const size_t band : on_indices) {
+                zldsp::vector::copy(summed_mags_[band].data(), dynamic_mags_[band].data(), kNumPoints);
+                zldsp::vector::add(sum_mags.data(), summed_mags_[band].data(), kNumPoints);
+                to_update_sum_flags_[band] = false;
+            }
+            return;
+        }
+        // replace the old contribution of each changed band with the new one
+        namespace hn = hwy::HWY_NAMESPACE;
+        static constexpr hn::ScalableTag<float> d;
+        static constexpr size_t lanes = hn::MaxLanes(d);
+        for (const size_t band : on_indices) {
+            if (!to_update_sum_flags_[band]) {
+                continue;
+            }
+            to_update_sum_flags_[band] = false;
+            float* HWY_RESTRICT sum_ptr = sum_mags.data();
+            float* HWY_RESTRICT old_ptr = summed_mags_[band].data();
+            const float* HWY_RESTRICT new_ptr = dynamic_mags_[band].data();
+            size_t i = 0;
+            for (; i + lanes <= kNumPoints; i += lanes) {
+                const auto v_new = hn::Load(d, new_ptr + i);
+                const auto v_diff = hn::Sub(v_new, hn::Load(d, old_ptr + i));
+                hn::Store(hn::Add(hn::Load(d, sum_ptr + i), v_diff), d, sum_ptr + i);
+                hn::Store(v_new, d, old_ptr + i);
+            }
+            for (; i < kNumPoints; ++i) {
+                sum_ptr[i] += new_ptr[i] - old_ptr[i];
+                old_ptr[i] = new_ptr[i];
+            }
+        }
+    }
+
+    void ResponsePanel::upsampleCoarseMags(const zldsp::vector::aligned_vector<float>& coarse_mags,
+                                           zldsp::vector::aligned_vector<float>& mags) {
+        for (size_t j = 0; j + 1 < kNumCoarsePoints; ++j) {
+            const auto start = coarse_mags[j];
+            const auto slope = (coarse_mags[j + 1] - start) / static_cast<float>(kCoarseStep);
+            for (size_t k = 0; k < kCoarseStep; ++k) {
+                mags[j * kCoarseStep + k] = start + slope * static_cast<float>(k);
+            }
+        }
+        mags.back() = coarse_mags.back();
     }
 
     float ResponsePanel::getButtonMag(const zldsp::filter::FilterParameters& para) {
@@ -592,4 +720,8 @@ namespace zlpanel {
     void ResponsePanel::turnMatchON(const bool match_on) {
         dragger_panel_.setVisible(!match_on);
     }
+
+    void ResponsePanel::setQualityLevel(const int level) {
+        quality_level_.store(level, std::memory_order::relaxed);
+    }
 }
@@ -14,10 +14,10 @@
 #include "dragger_panel/dragger_panel.hpp"
 #include "solo_panel.hpp"
 #include "../../../chore/thread/notifier.hpp"
+#include "../../../dsp/filter/ideal_filter/ideal_batch.hpp"
 
 namespace zlpanel {
     class ResponsePanel final : public juce::Component,
-                                public juce::Thread,
                                 private juce::AudioProcessorValueTreeState::Listener {
     public:
         explicit ResponsePanel(PluginProcessor& p, zlgui::UIBase& base,
@@ -37,10 +37,16 @@ namespace zlpanel {
 
         void updateSampleRate(double sample_rate);
 
-        void run() override;
+        void run(const juce::ThreadPoolJob& job);
 
         void turnMatchON(bool match_on);
 
+        /**
+         * set the FrameGovernor quality level
+         * @param level
+         */
+        void setQualityLevel(int level);
+
     private:
         static constexpr std::array kIDs{
             zlp::PFilterStatus::kID, zlp::PLRMode::kID,
@@ -51,6 +57,23 @@ namespace zlpanel {
         };
 
         static constexpr size_t kNumPoints = 400;
+        // dynamic responses are evaluated on every third point from FrameGovernor::kReducedPoints
+        static constexpr size_t kCoarseStep = 3;
+        static constexpr size_t kNumCoarsePoints = (kNumPoints - 1) / kCoarseStep + 1;
+        static_assert((kNumPoints - 1) % kCoarseStep == 0);
+        // the incremental sums are rebuilt from scratch after this many updates to bound the rounding drift
+        static constexpr int kFullSumInterval = 64;
+
+        /**
+         * the effective parameters a response curve has been evaluated with
+         */
+        struct CurveFingerprint {
+            zldsp::filter::FilterParameters para{};
+            bool is_coarse{false};
+            bool is_valid{false};
+
+            bool operator==(const CurveFingerprint&) const = default;
+        };
 
         PluginProcessor& p_ref_;
         zlgui::UIBase& base_;
@@ -87,14 +110,32 @@ namespace zlpanel {
 
         std::vector<float> ws_;
         std::vector<float> xs_;
+        std::vector<float> coarse_ws_;
+        std::array<zldsp::vector::aligned_vector<float>, zlp::kBandNum> coarse_mags_;
+        std::atomic<int> quality_level_{FrameGovernor::kFull};
+        int c_quality_level_{FrameGovernor::kFull};
 
         std::array<zldsp::filter::Ideal<float, zlp::Controller::kFilterSize>, zlp::kBandNum> ideal_{};
         std::array<zldsp::filter::Ideal<float, zlp::Controller::kFilterSize / 2>, zlp::kBandNum> side_ideal_{};
+        // base, target and dynamic responses of all bands on the full grid
+        zldsp::filter::IdealBatch<float, 3 * zlp::kBandNum * zlp::Controller::kFilterSize, 3 * zlp::kBandNum> batch_;
+        // dynamic responses of all bands on the coarse grid
+        zldsp::filter::IdealBatch<float, zlp::kBandNum * zlp::Controller::kFilterSize, zlp::kBandNum> coarse_batch_;
 
         std::array<zldsp::vector::aligned_vector<float>, zlp::kBandNum> base_mags_;
         std::array<zldsp::vector::aligned_vector<float>, zlp::kBandNum> target_mags_;
         std::array<zldsp::vector::aligned_vector<float>, zlp::kBandNum> dynamic_mags_;
         std::array<zldsp::vector::aligned_vector<float>, 5> sum_mags_;
+        // the dynamic response of each band as it is currently accumulated in sum_mags_
+        std::array<zldsp::vector::aligned_vector<float>, zlp::kBandNum> summed_mags_;
+        std::array<bool, zlp::kBandNum> to_update_sum_flags_{};
+        std::array<bool, 5> to_rebuild_sum_flags_{};
+        std::array<int, 5> sum_update_counts_{};
+
+        std::array<CurveFingerprint, zlp::kBandNum> base_fingerprints_{};
+        std::array<CurveFingerprint, zlp::kBandNum> target_fingerprints_{};
+        std::array<CurveFingerprint, zlp::kBandNum> dynamic_fingerprints_{};
+        std::array<float, zlp::kBandNum> center_dbs_{};
 
         std::array<zldsp::filter::Empty, zlp::kBandNum> empty_{};
         std::array<zlchore::thread::Notifier, zlp::kBandNum> to_update_empty_flags_{};
@@ -121,6 +162,8 @@ namespace zlpanel {
         std::array<bool, zlp::kBandNum> to_update_base_y_flags_{};
         std::array<bool, zlp::kBandNum> to_update_target_y_flags_{};
         std::array<bool, zlp::kBandNum> to_update_side_y_flags_{};
+        std::array<bool, zlp::kBandNum> to_update_dynamic_flags_{};
+        std::array<double, zlp::kBandNum> c_dynamic_gains_{};
 
         // center x, left x, right x, center y, base button y, target button y
         std::array<std::array<std::atomic<float>, 6>, zlp::kBandNum> points_{};
@@ -131,7 +174,14 @@ namespace zlpanel {
 
         void updateCurveParas();
 
-        bool updateCurveMags();
+        bool updateCurveMags(const juce::ThreadPoolJob& job);
+
+        static void upsampleCoarseMags(const zldsp::vector::aligned_vector<float>& coarse_mags,
+                                       zldsp::vector::aligned_vector<float>& mags);
+
+        void copyBaseToDynamicMags(size_t band);
+
+        void updateSumMags(size_t lr);
 
         static float getButtonMag(const zldsp::filter::FilterParameters& para);
 
@@ -49,10 +49,9 @@ namespace zlpanel {
         lookAndFeelChanged();
     }
 
-    void SumPanel::run(const size_t lr, const bool to_update, const bool is_not_off,
-                       const std::span<size_t> on_indices,
-                       const std::span<float> xs, float k, float b,
-                       std::array<zldsp::vector::aligned_vector<float>, zlp::kBandNum>& dynamic_mags) {
+    void SumPanel::run(const size_t lr, const bool to_update, const bool is_not_off, const bool has_on_bands,
+                       const std::span<float> xs, const float k, const float b,
+                       const std::span<const float> sum_mags) {
         if (!to_update) {
             return;
         }
@@ -60,7 +59,7 @@ namespace zlpanel {
         auto& path{paths_[lr].getWriter()};
         path.clear();
 
-        if (on_indices.empty()) {
+        if (!has_on_bands) {
             if (is_not_off) {
                 path.startNewSubPath(xs[0], b);
                 path.lineTo(xs.back(), b);
@@ -78,19 +77,10 @@ namespace zlpanel {
             const auto vb = hn::Set(d, b);
             size_t i = 0;
             for (; i + lanes <= temp_db_.size(); i += lanes) {
-                auto v_sum = hn::Zero(d);
-                for (const size_t on_index : on_indices) {
-                    const float* mag_ptr = dynamic_mags[on_index].data();
-                    v_sum = hn::Add(v_sum, hn::Load(d, mag_ptr + i));
-                }
-                hn::Store(hn::MulAdd(vk, v_sum, vb), d, temp_db_.data() + i);
+                hn::Store(hn::MulAdd(vk, hn::LoadU(d, sum_mags.data() + i), vb), d, temp_db_.data() + i);
             }
             for (; i < temp_db_.size(); ++i) {
-                float sum = 0.0f;
-                for (const size_t on_index : on_indices) {
-                    sum += dynamic_mags[on_index][i];
-                }
-                temp_db_[i] = std::fma(k, sum, b);
+                temp_db_[i] = std::fma(k, sum_mags[i], b);
             }
         }
 
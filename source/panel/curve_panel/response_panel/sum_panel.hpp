@@ -27,10 +27,20 @@ namespace zlpanel {
 
         void updateDrawingParas(int lr, bool is_same_stereo);
 
-        void run(size_t lr, bool to_update, bool is_not_off,
-                 std::span<size_t> on_indices,
+        /**
+         * draw the summed response of one stereo mode
+         * @param lr the stereo mode
+         * @param to_update whether the path should be redrawn
+         * @param is_not_off whether any band of this stereo mode is not off
+         * @param has_on_bands whether any band of this stereo mode is on
+         * @param xs
+         * @param k
+         * @param b
+         * @param sum_mags the summed response in dB of all on bands
+         */
+        void run(size_t lr, bool to_update, bool is_not_off, bool has_on_bands,
                  std::span<float> xs, float k, float b,
-                 std::array<zldsp::vector::aligned_vector<float>, zlp::kBandNum>& dynamic_mags);
+                 std::span<const float> sum_mags);
 
     private:
         static constexpr size_t kNumPoints = 400;
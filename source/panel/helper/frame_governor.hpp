@@ -0,0 +1,137 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+
+namespace zlpanel {
+    /**
+     * a governor which keeps the analysis cost of one editor under a CPU budget
+     * workers report their cost with addCost(), the message thread calls update() once per frame
+     * the quality level steps up when the budget is exceeded and steps down when headroom returns
+     */
+    class FrameGovernor {
+    public:
+        enum Level : int {
+            kFull = 0,
+            kSkipLargestFFT = 1,
+            kHalfRate = 2,
+            kReducedPoints = 3,
+            kNoCollision = 4,
+            kMaxLevel = kNoCollision
+        };
+
+        static constexpr double kDefaultBudget = 0.25;
+
+        explicit FrameGovernor(const double budget = kDefaultBudget) {
+            setBudget(budget);
+        }
+
+        /**
+         * set the CPU budget
+         * @param budget the allowed fraction of one core, e.g. 0.25 for 25%
+         */
+        void setBudget(const double budget) {
+            budget_.store(std::max(budget, 0.01), std::memory_order::relaxed);
+        }
+
+        /**
+         * report the cost of one piece of work, thread-safe
+         * @param seconds
+         */
+        void addCost(const double seconds) {
+            cost_ns_.fetch_add(static_cast<int64_t>(seconds * 1e9), std::memory_order::relaxed);
+        }
+
+        /**
+         * evaluate the usage and adjust the level, must be called from a single thread
+         * @param time_stamp current time in seconds
+         * @return whether the level has changed
+         */
+        bool update(const double time_stamp) {
+            if (!std::isfinite(time_stamp)) {
+                return false;
+            }
+            if (window_start_ < 0.0 || time_stamp < window_start_) {
+                window_start_ = time_stamp;
+                cost_ns_.store(0, std::memory_order::relaxed);
+                return false;
+            }
+            const auto elapsed = time_stamp - window_start_;
+            if (elapsed < kWindowSeconds) {
+                return false;
+            }
+            window_start_ = time_stamp;
+            const auto usage = static_cast<double>(cost_ns_.exchange(0, std::memory_order::relaxed)) * 1e-9 / elapsed;
+            const auto budget = budget_.load(std::memory_order::relaxed);
+            const auto level = level_.load(std::memory_order::relaxed);
+            if (usage > budget) {
+                headroom_count_ = 0;
+                if (level < kMaxLevel) {
+                    level_.store(level + 1, std::memory_order::relaxed);
+                    return true;
+                }
+            } else if (usage < budget * kRestoreRatio) {
+                headroom_count_ += 1;
+                if (headroom_count_ >= kRestoreWindows && level > kFull) {
+                    headroom_count_ = 0;
+                    level_.store(level - 1, std::memory_order::relaxed);
+                    return true;
+                }
+            } else {
+                headroom_count_ = 0;
+            }
+            return false;
+        }
+
+        [[nodiscard]] int getLevel() const {
+            return level_.load(std::memory_order::relaxed);
+        }
+
+        /**
+         * measure the wall time of a piece of work and report it on destruction
+         * wall time also counts the time the thread was preempted, so a loaded machine raises the level even when
+         * the work itself did not get more expensive, the hysteresis keeps this from flickering but not from
+         * stepping up under a sustained load of other processes
+         */
+        class ScopedCost {
+        public:
+            explicit ScopedCost(FrameGovernor& governor) :
+                governor_(governor), start_(std::chrono::steady_clock::now()) {
+            }
+
+            ~ScopedCost() {
+                const std::chrono::duration<double> cost = std::chrono::steady_clock::now() - start_;
+                governor_.addCost(cost.count());
+            }
+
+        private:
+            FrameGovernor& governor_;
+            std::chrono::steady_clock::time_point start_;
+        };
+
+    private:
+        // evaluate the usage over half a second
+        static constexpr double kWindowSeconds = 0.5;
+        // restore one level after two windows below half of the budget
+        static constexpr double kRestoreRatio = 0.5;
+        static constexpr int kRestoreWindows = 2;
+
+        std::atomic<double> budget_{kDefaultBudget};
+        std::atomic<int64_t> cost_ns_{0};
+        std::atomic<int> level_{kFull};
+        double window_start_{-1.0};
+        int headroom_count_{0};
+    };
+}
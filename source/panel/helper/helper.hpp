@@ -18,3 +18,7 @@
 #include "band_helper.hpp"
 #include "freq_helper.hpp"
 #include "tri_buffer.hpp"
+#include "worker_pool.hpp"
+#include "frame_governor.hpp"
+#include "image_layer.hpp"
+#include "idle_tracker.hpp"
@@ -0,0 +1,81 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <vector>
+
+#include "../../dsp/container/fifo/fifo_base.hpp"
+#include "../../dsp/vector/vector.hpp"
+
+namespace zlpanel {
+    /**
+     * decide whether an analyzer frame has to be computed
+     * a frame is skipped once the input is silent and the display has settled for kSettledFrames frames
+     * new signal or a changed setting resumes the analysis at once
+     */
+    class IdleTracker {
+    public:
+        // input below -120 dBFS counts as silence
+        static constexpr float kSilenceLevel = 1e-6f;
+        // the display is settled once the paths move less than this for kSettledFrames frames
+        static constexpr float kSettledPixels = 0.05f;
+        static constexpr int kSettledFrames = 3;
+
+        /**
+         * call before computing a frame
+         * @param is_input_active whether any enabled source carried signal since the last frame
+         * @param is_changed whether a display setting changed since the last frame
+         * @return whether the frame has to be computed
+         */
+        bool shouldCompute(const bool is_input_active, const bool is_changed) {
+            if (is_input_active || is_changed) {
+                settled_frames_ = 0;
+                return true;
+            }
+            return settled_frames_ < kSettledFrames;
+        }
+
+        /**
+         * call after a frame has been computed
+         * @param is_input_active whether any enabled source carried signal since the last frame
+         * @param max_change the largest movement of the paths in pixels
+         */
+        void finishFrame(const bool is_input_active, const float max_change) {
+            if (!is_input_active && max_change < kSettledPixels) {
+                settled_frames_ += 1;
+            } else {
+                settled_frames_ = 0;
+            }
+        }
+
+        /**
+         * @return whether the samples in the range of any channel exceed kSilenceLevel
+         */
+        static bool hasSignal(const zldsp::container::FIFORange range,
+                              const std::vector<std::vector<float>>& sample_fifo) {
+            for (const auto& samples : sample_fifo) {
+                if (range.block_size1 > 0 && zldsp::vector::max_abs_of(
+                        samples.data() + static_cast<size_t>(range.start_index1),
+                        static_cast<size_t>(range.block_size1)) > kSilenceLevel) {
+                    return true;
+                }
+                if (range.block_size2 > 0 && zldsp::vector::max_abs_of(
+                        samples.data() + static_cast<size_t>(range.start_index2),
+                        static_cast<size_t>(range.block_size2)) > kSilenceLevel) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+    private:
+        int settled_frames_{0};
+    };
+}
@@ -0,0 +1,104 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <juce_graphics/juce_graphics.h>
+#include <atomic>
+#include <cmath>
+
+#include "tri_buffer.hpp"
+
+namespace zlpanel {
+    /**
+     * a layer which is rasterised on a worker thread and blitted on the message thread
+     * the images are triple-buffered so that the worker never draws into the image being blitted
+     * the images are created at the physical pixel size, so they stay sharp on high-DPI displays
+     */
+    class ImageLayer {
+    public:
+        ImageLayer() = default;
+
+        /**
+         * set the physical pixel scale, must be called on the message thread
+         * @param scale
+         * @return whether the scale has changed
+         */
+        bool setScale(const float scale) {
+            const auto old_scale = scale_.exchange(scale, std::memory_order::relaxed);
+            return std::abs(old_scale - scale) > 1e-3f;
+        }
+
+        /**
+         * rasterise a new frame, must be called on the worker thread
+         * @param width the logical width of the layer
+         * @param height the logical height of the layer
+         * @param painter the function which draws the layer in logical coordinates
+         */
+        template <typename Painter>
+        void render(const float width, const float height, Painter&& painter) {
+            if (width < 1.f || height < 1.f) {
+                return;
+            }
+            const auto scale = scale_.load(std::memory_order::relaxed);
+            auto& frame{frames_.getWriter()};
+            const auto physical_width = static_cast<int>(std::ceil(width * scale));
+            const auto physical_height = static_cast<int>(std::ceil(height * scale));
+            if (!frame.image.isValid()
+                || frame.image.getWidth() != physical_width || frame.image.getHeight() != physical_height) {
+                frame.image = juce::Image(juce::Image::ARGB, physical_width, physical_height, true,
+                                          juce::SoftwareImageType());
+            } else {
+                frame.image.clear(frame.image.getBounds());
+            }
+            frame.width = width;
+            frame.height = height;
+            frame.scale = scale;
+            {
+                juce::Graphics g(frame.image);
+                g.addTransform(juce::AffineTransform::scale(scale));
+                painter(g);
+            }
+            frames_.publish();
+        }
+
+        /**
+         * blit the latest frame, must be called on the message thread
+         * a frame which has been rasterised for another size is stretched to the current size until the worker
+         * catches up, so resizing does not blank the layer
+         * @param g
+         * @param width the current logical width of the layer
+         * @param height the current logical height of the layer
+         */
+        void draw(juce::Graphics& g, const float width, const float height) {
+            frames_.pull();
+            const auto& frame{frames_.getReader()};
+            if (!frame.image.isValid() || frame.width < 1.f || frame.height < 1.f) {
+                return;
+            }
+            if (std::abs(frame.width - width) > .5f || std::abs(frame.height - height) > .5f) {
+                g.drawImageTransformed(frame.image, juce::AffineTransform::scale(
+                                           width / (frame.width * frame.scale),
+                                           height / (frame.height * frame.scale)));
+                return;
+            }
+            g.drawImageTransformed(frame.image, juce::AffineTransform::scale(1.f / frame.scale));
+        }
+
+    private:
+        struct Frame {
+            juce::Image image{};
+            float width{0.f}, height{0.f};
+            float scale{1.f};
+        };
+
+        TriBuffer<Frame> frames_;
+        std::atomic<float> scale_{1.f};
+    };
+}
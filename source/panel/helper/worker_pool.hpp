@@ -0,0 +1,145 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <juce_events/juce_events.h>
+#include <algorithm>
+#include <atomic>
+#include <functional>
+
+namespace zlpanel {
+    /**
+     * a bounded thread pool shared by all editors in the host process
+     * hold it with juce::SharedResourcePointer so that it lives as long as any editor
+     */
+    class WorkerPool {
+    public:
+        static constexpr int kMaxNumWorkers = 4;
+
+        WorkerPool() :
+            pool_(juce::ThreadPoolOptions{}
+                  .withThreadName("zl_worker")
+                  .withNumberOfThreads(getNumWorkers())
+                  .withDesiredThreadPriority(juce::Thread::Priority::low)) {
+        }
+
+        juce::ThreadPool& getPool() {
+            return pool_;
+        }
+
+    private:
+        juce::ThreadPool pool_;
+
+        static int getNumWorkers() {
+            return std::clamp(juce::SystemStats::getNumCpus() - 1, 1, kMaxNumWorkers);
+        }
+    };
+
+    /**
+     * a coalescing job on the shared worker pool
+     * each trigger() requests one run of the work, triggers that arrive while the job is queued or running
+     * are merged into a single extra run, trigger() never waits for the pool
+     */
+    class WorkerTask final : private juce::ThreadPoolJob, private juce::AsyncUpdater {
+    public:
+        using Work = std::function<void(const juce::ThreadPoolJob&)>;
+
+        WorkerTask(const juce::String& name, juce::ThreadPool& pool, Work work) :
+            juce::ThreadPoolJob(name), pool_(pool), work_(std::move(work)) {
+        }
+
+        ~WorkerTask() override {
+            stop();
+        }
+
+        /**
+         * allow the task to be submitted, must be called on the message thread
+         */
+        void start() {
+            is_started_ = true;
+        }
+
+        /**
+         * prevent further submission and wait until the running work returns, must be called on the message thread
+         */
+        void stop() {
+            is_started_ = false;
+            cancelPendingUpdate();
+            to_run_.store(false, std::memory_order::relaxed);
+            (void)pool_.removeJob(this, true, -1);
+            queued_.store(false, std::memory_order::release);
+        }
+
+        /**
+         * request one run of the work, must be called on the message thread
+         */
+        void trigger() {
+            if (!is_started_) {
+                return;
+            }
+            to_run_.store(true, std::memory_order::release);
+            submit();
+        }
+
+    private:
+        juce::ThreadPool& pool_;
+        Work work_;
+        bool is_started_{false};
+        std::atomic<bool> to_run_{false};
+        // true while the job is owned by the pool, only the thread which sets it may add the job
+        std::atomic<bool> queued_{false};
+
+        /**
+         * add the job to the pool unless it is queued or running, in which case it picks up to_run_ itself
+         */
+        void submit() {
+            bool expected = false;
+            if (!queued_.compare_exchange_strong(expected, true, std::memory_order::acq_rel)) {
+                return;
+            }
+            if (pool_.contains(this)) {
+                // the last run has released the flag but the pool has not dropped the job yet
+                // retry from the message loop instead of waiting for the pool
+                queued_.store(false, std::memory_order::release);
+                triggerAsyncUpdate();
+                return;
+            }
+            pool_.addJob(this, false);
+        }
+
+        void handleAsyncUpdate() override {
+            if (is_started_ && to_run_.load(std::memory_order::acquire)) {
+                submit();
+            }
+        }
+
+        JobStatus runJob() override {
+            if (to_run_.exchange(false, std::memory_order::acquire)) {
+                work_(*this);
+            }
+            if (shouldExit()) {
+                queued_.store(false, std::memory_order::release);
+                return jobHasFinished;
+            }
+            if (to_run_.load(std::memory_order::acquire)) {
+                return jobNeedsRunningAgain;
+            }
+            queued_.store(false, std::memory_order::release);
+            // a trigger between the check above and the release would otherwise be lost
+            bool expected = false;
+            if (to_run_.load(std::memory_order::acquire)
+                && queued_.compare_exchange_strong(expected, true, std::memory_order::acq_rel)) {
+                return jobNeedsRunningAgain;
+            }
+            return jobHasFinished;
+        }
+    };
+}
@@ -91,16 +91,16 @@ namespace zlpanel {
         base_(base),
         presets_directory_(getPresetsDirectory()),
         background_(base),
-        delete_drawable_(juce::Drawable::createFromImageData(BinaryData::trash_svg,
-                                                             BinaryData::trash_svgSize)),
-        close_drawable_(juce::Drawable::createFromImageData(BinaryData::close_svg,
-                                                            BinaryData::close_svgSize)),
-        folder_open_drawable_(juce::Drawable::createFromImageData(BinaryData::folder_open_svg,
-                                                                  BinaryData::folder_open_svgSize)),
-        delete_group_button_(base, delete_drawable_.get(), nullptr, ""),
-        delete_preset_button_(base, delete_drawable_.get(), nullptr, ""),
-        close_button_(base, close_drawable_.get(), nullptr, ""),
-        folder_open_button_(base, folder_open_drawable_.get(), nullptr, ""),
+        delete_drawable_(base.getSharedDrawable(BinaryData::trash_svg,
+                                                BinaryData::trash_svgSize)),
+        close_drawable_(base.getSharedDrawable(BinaryData::close_svg,
+                                               BinaryData::close_svgSize)),
+        folder_open_drawable_(base.getSharedDrawable(BinaryData::folder_open_svg,
+                                                     BinaryData::folder_open_svgSize)),
+        delete_group_button_(base, delete_drawable_, nullptr, ""),
+        delete_preset_button_(base, delete_drawable_, nullptr, ""),
+        close_button_(base, close_drawable_, nullptr, ""),
+        folder_open_button_(base, folder_open_drawable_, nullptr, ""),
         group_label_({}, "Groups"),
         preset_label_({}, "Presets"),
         search_editor_(base),
@@ -40,6 +40,12 @@ namespace zlp {
             controller_.setPhaseFlipON(value > .5f);
         } else if (parameter_ID == PLookahead::kID) {
             controller_.setDelay(static_cast<double>(value) * 0.001);
+        } else if (parameter_ID == PDynamicControl::kID) {
+            const auto idx = std::clamp(static_cast<size_t>(std::round(value)),
+                                        static_cast<size_t>(0), PDynamicControl::kIntervals.size() - 1);
+            controller_.setDynamicControlInterval(PDynamicControl::kIntervals[idx]);
+        } else if (parameter_ID == PFIRSchedule::kID) {
+            controller_.setFIRAmortised(value > .5f);
         }
     }
 }
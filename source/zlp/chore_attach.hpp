@@ -28,7 +28,8 @@ namespace zlp {
         static constexpr std::array kIDs{
             PFilterStructure::kID, POutputGain::kID,
             PStaticGain::kID, PAutoGain::kID,
-            PPhaseFlip::kID, PLookahead::kID
+            PPhaseFlip::kID, PLookahead::kID,
+            PDynamicControl::kID, PFIRSchedule::kID
         };
 
         void parameterChanged(const juce::String& parameter_ID, float value) override;
@@ -23,13 +23,20 @@ namespace zlp {
         for (auto& f : side_emptys_) {
             f.setFilterType(zldsp::filter::kBandPass);
         }
+        measurement_thread_->getThread().addTimeSliceClient(this);
+    }
+
+    Controller::~Controller() {
+        measurement_thread_->getThread().removeTimeSliceClient(this);
     }
 
     void Controller::prepare(const double sample_rate, const size_t max_num_samples) {
         c_filter_structure_ = kMinimum;
+        // scratch buffers only need to hold one tile
+        const auto tile_num_samples = std::min(max_num_samples, kTileSize);
 
-        side_buffers[0].resize(max_num_samples);
-        side_buffers[1].resize(max_num_samples);
+        side_buffers[0].resize(tile_num_samples);
+        side_buffers[1].resize(tile_num_samples);
         side_copy_pointers_.reserve(2);
 
         for (size_t i = 0; i < kBandNum; ++i) {
@@ -39,13 +46,13 @@ namespace zlp {
 
         for (size_t i = 0; i < kBandNum; ++i) {
             dynamic_side_handlers_[i].prepare(sample_rate, 41. / 1000.);
-            tdf_filters_[i].prepare(sample_rate, 2, max_num_samples);
+            tdf_filters_[i].prepare(sample_rate, 2, tile_num_samples);
             tdf_filters_[i].getFilter().updateParas(filter_paras_[i]);
-            svf_filters_[i].prepare(sample_rate, 2, max_num_samples);
+            svf_filters_[i].prepare(sample_rate, 2, tile_num_samples);
             svf_filters_[i].getFilter().updateParas(filter_paras_[i]);
-            parallel_filters_[i].prepare(sample_rate, 2, max_num_samples);
+            parallel_filters_[i].prepare(sample_rate, 2, tile_num_samples);
             parallel_filters_[i].getFilter().updateParas(filter_paras_[i]);
-            side_filters_[i].prepare(sample_rate, 2, max_num_samples);
+            side_filters_[i].prepare(sample_rate, 2, tile_num_samples);
             side_filters_[i].updateParas(side_filter_paras_[i]);
             res_ideals_[i].prepare(sample_rate);
             res_tdfs_[i].prepare(sample_rate, 1, 0);
@@ -61,6 +68,7 @@ namespace zlp {
         slow_hist_unit_decay_ = std::pow(0.99, 1.0 / sample_rate);
 
         for (size_t chan = 0; chan < 2; ++chan) {
+            // the pre and solo buffers hold the whole block, since the AGC pass reads them after all tiles
             pre_main_buffers_[chan].resize(max_num_samples);
             pre_main_pointers_[chan] = pre_main_buffers_[chan].data();
         }
@@ -73,8 +81,8 @@ namespace zlp {
             solo_buffers_[chan].resize(max_num_samples);
             solo_pointers_[chan] = solo_buffers_[chan].data();
         }
-        solo_filter_.prepare(sample_rate, 2, max_num_samples);
-        solo_gain_.prepare(sample_rate, max_num_samples, 0.5);
+        solo_filter_.prepare(sample_rate, 2, tile_num_samples);
+        solo_gain_.prepare(sample_rate, tile_num_samples, 0.5);
         if (c_solo_side_) {
             updateSoloFilter<true>(side_filter_paras_[c_solo_idx_]);
         } else {
@@ -82,10 +90,10 @@ namespace zlp {
         }
 
         loudness_matcher_.prepare(sample_rate, 2);
-        sgc_gain_.prepare(sample_rate, max_num_samples, 0.5);
-        output_gain_.prepare(sample_rate, max_num_samples, 0.5);
+        sgc_gain_.prepare(sample_rate, tile_num_samples, 0.5);
+        output_gain_.prepare(sample_rate, tile_num_samples, 0.5);
 
-        delay_.prepare(sample_rate, max_num_samples, 2, 0.021);
+        delay_.prepare(sample_rate, tile_num_samples, 2, 0.021);
         to_update_delay_.signal();
         to_update_output_.signal();
         to_update_.signal();
@@ -102,6 +110,9 @@ namespace zlp {
         if (to_update_dynamic_.check()) {
             prepareDynamics();
         }
+        if (to_update_control_interval_.check()) {
+            prepareControlInterval();
+        }
         if (to_update_lrms_.check()) {
             prepareLRMS();
             to_update_correction_indices_ = true;
@@ -120,6 +131,7 @@ namespace zlp {
         if (to_update_output_.check()) {
             prepareOutput();
         }
+        prepareSideConsumers();
     }
 
     void Controller::prepareUIStatus() {
@@ -139,7 +151,7 @@ namespace zlp {
                 std::fill(res_update_flags_.begin(), res_update_flags_.end(), true);
             } else if (correction_latency_.exchange(0, std::memory_order::relaxed) != 0) {
                 // is zero latency, update latency
-                triggerAsyncUpdate();
+                to_update_latency_.signal();
             }
             // force update all filters
             for (size_t i = 0; i < kBandNum; ++i) {
@@ -151,6 +163,11 @@ namespace zlp {
                 svf_filters_[i].reset();
                 parallel_filters_[i].reset();
             }
+            // drop the frames (and the pending amortised frame) left in the correction processors,
+            // otherwise a processor which becomes active again would finish a stale frame
+            match_stereo_fir_.reset();
+            mixed_stereo_fir_.reset();
+            zero_stereo_fir_.reset();
             // update lr/ms on flags as they might be changed by corrections
             is_lr_on_ = !not_off_indices_[1].empty() || !not_off_indices_[2].empty();
             is_ms_on_ = !not_off_indices_[3].empty() || !not_off_indices_[4].empty();
@@ -158,6 +175,16 @@ namespace zlp {
         } else {
             to_update_correction_indices_ = false;
         }
+        if (c_fir_amortised_ != fir_amortised_.load(std::memory_order::relaxed)) {
+            c_fir_amortised_ = fir_amortised_.load(std::memory_order::relaxed);
+            match_stereo_fir_.setAmortised(c_fir_amortised_);
+            mixed_stereo_fir_.setAmortised(c_fir_amortised_);
+            zero_stereo_fir_.setAmortised(c_fir_amortised_);
+            // update the latency
+            if (c_correction_enabled_) {
+                to_update_correction_indices_ = true;
+            }
+        }
         if (to_update_status_.check()) {
             // cache total not off indices
             not_off_total_.clear();
@@ -303,6 +330,15 @@ namespace zlp {
         }
     }
 
+    void Controller::prepareControlInterval() {
+        const auto control_interval = dynamic_control_interval_.load(std::memory_order::relaxed);
+        for (size_t i = 0; i < kBandNum; ++i) {
+            tdf_filters_[i].setControlInterval(control_interval);
+            svf_filters_[i].setControlInterval(control_interval);
+            parallel_filters_[i].setControlInterval(control_interval);
+        }
+    }
+
     void Controller::prepareCorrectionIndices() {
         correction_on_total_.clear();
         for (size_t lr = 0; lr < 5; ++lr) {
@@ -336,7 +372,7 @@ namespace zlp {
         }
         // latency is constant once correction is enabled
         if (correction_latency_.exchange(unit_latency, std::memory_order::relaxed) != unit_latency) {
-            triggerAsyncUpdate();
+            to_update_latency_.signal();
         }
         force_update_correction_ = true;
     }
@@ -368,8 +404,13 @@ namespace zlp {
         }
         }
         bool needs_update = force_update_correction_;
+        // a forced update rebuilds all products, otherwise only the products of changed bands are updated
+        const auto dirty_flags = force_update_correction_
+                                     ? std::span<const bool>{}
+                                     : std::span<const bool>{correction_dirty_flags_};
         force_update_correction_ = false;
         for (const size_t& i : correction_on_total_) {
+            correction_dirty_flags_[i] = res_update_flags_[i];
             if (res_update_flags_[i]) {
                 needs_update = true;
                 res_update_flags_[i] = false;
@@ -381,19 +422,19 @@ namespace zlp {
             case kMatched: {
                 match_stereo_fir_.updateCorrection(match_calculator_.getCorrectionsReal(),
                                                    match_calculator_.getCorrectionsImag(),
-                                                   correction_on_indices_);
+                                                   correction_on_indices_, dirty_flags);
                 break;
             }
             case kMixed: {
                 mixed_stereo_fir_.updateCorrection(mixed_calculator_.getCorrectionsReal(),
                                                    mixed_calculator_.getCorrectionsImag(),
-                                                   correction_on_indices_);
+                                                   correction_on_indices_, dirty_flags);
                 break;
             }
             case kZero: {
                 zero_stereo_fir_.updateCorrection(zero_calculator_.getCorrectionsReal(),
                                                   zero_calculator_.getCorrectionsImag(),
-                                                  correction_on_indices_);
+                                                  correction_on_indices_, dirty_flags);
                 break;
             }
             case kMinimum:
@@ -440,7 +481,8 @@ namespace zlp {
                         slow_histograms_[i].reset();
                         learned_thresholds_[i].store(-40.0, std::memory_order::relaxed);
                     }
-                    hist_results_[1] = 0.0;
+                    hist_medians_[i] = 0.0;
+                    side_square_sums_[i] = 0.0;
                 }
                 if (c_dynamic_th_learn_[i]) {
                     c_dynamic_threshold_[i] = dynamic_threshold_[i].load(std::memory_order::relaxed) + 40.0;
@@ -472,6 +514,17 @@ namespace zlp {
         }
     }
 
+    void Controller::prepareSideConsumers() {
+        const auto is_dynamic_on = [&](const std::vector<size_t>& indices) {
+            return std::any_of(indices.begin(), indices.end(), [&](const size_t i) {
+                return c_dynamic_on_[i];
+            });
+        };
+        c_ms_side_on_ = is_dynamic_on(not_off_indices_[3]) || is_dynamic_on(not_off_indices_[4]);
+        c_side_on_ = c_editor_on_ || c_ms_side_on_ || is_dynamic_on(not_off_indices_[0])
+            || is_dynamic_on(not_off_indices_[1]) || is_dynamic_on(not_off_indices_[2]);
+    }
+
     void Controller::prepareOutput() {
         const auto sgc_on = sgc_on_.load(std::memory_order::relaxed);
         if (c_sgc_on_ != sgc_on) {
@@ -491,6 +544,8 @@ namespace zlp {
         if (loudness_matcher_on != c_loudness_matcher_on_) {
             c_loudness_matcher_on_ = loudness_matcher_on;
             if (c_loudness_matcher_on_) {
+                // pick the mode first, so the reset never takes the offline path during real-time playback
+                loudness_matcher_.setRealTime(!p_ref_.isNonRealtime());
                 loudness_matcher_.reset();
             }
         }
@@ -509,14 +564,98 @@ namespace zlp {
             c_delay_on_ = std::abs(delay_second) > 1e-6;
             delay_.setDelay(c_delay_on_ ? delay_second : 0.);
             delay_latency_.store(delay_.getDelayInSamples(), std::memory_order::relaxed);
-            triggerAsyncUpdate();
+            to_update_latency_.signal();
         }
     }
 
     template <bool bypass>
     void Controller::process(std::array<double*, 2> main_pointers, std::array<double*, 2> side_pointers,
                              const size_t num_samples) {
-        prepareBuffer();
+        // relative thresholds follow the side loudness of the whole block, not of a single tile
+        if (std::any_of(c_dynamic_th_relative_.begin(), c_dynamic_th_relative_.end(), [](const bool x) { return x; })) {
+            updateSidePowers(side_pointers, num_samples);
+        }
+        block_num_samples_ = num_samples;
+        // run the whole chain tile by tile so that main, side and scratch buffers stay cache-resident
+        if (!c_agc_on_) {
+            for (size_t start_idx = 0; start_idx < num_samples; start_idx += kTileSize) {
+                const auto tile_size = std::min(kTileSize, num_samples - start_idx);
+                is_last_tile_ = start_idx + tile_size == num_samples;
+                setTilePointers(start_idx);
+                processTileFront<bypass>({main_pointers[0] + start_idx, main_pointers[1] + start_idx},
+                                         {side_pointers[0] + start_idx, side_pointers[1] + start_idx},
+                                         tile_size);
+                processTileBack<bypass>({main_pointers[0] + start_idx, main_pointers[1] + start_idx},
+                                        {side_pointers[0] + start_idx, side_pointers[1] + start_idx},
+                                        tile_size);
+            }
+            setTilePointers(0);
+            return;
+        }
+        // the AGC gain depends on the pre/post power of the whole block
+        // so the output stage runs in a second pass after all tiles have been filtered
+        pre_square_sum_ = 0.0;
+        post_square_sum_ = 0.0;
+        for (size_t start_idx = 0; start_idx < num_samples; start_idx += kTileSize) {
+            const auto tile_size = std::min(kTileSize, num_samples - start_idx);
+            is_last_tile_ = start_idx + tile_size == num_samples;
+            setTilePointers(start_idx);
+            processTileFront<bypass>({main_pointers[0] + start_idx, main_pointers[1] + start_idx},
+                                     {side_pointers[0] + start_idx, side_pointers[1] + start_idx},
+                                     tile_size);
+        }
+        updateAGC(num_samples);
+        for (size_t start_idx = 0; start_idx < num_samples; start_idx += kTileSize) {
+            const auto tile_size = std::min(kTileSize, num_samples - start_idx);
+            setTilePointers(start_idx);
+            processTileBack<bypass>({main_pointers[0] + start_idx, main_pointers[1] + start_idx},
+                                    {side_pointers[0] + start_idx, side_pointers[1] + start_idx},
+                                    tile_size);
+        }
+        setTilePointers(0);
+    }
+
+    void Controller::setTilePointers(const size_t start_idx) {
+        for (size_t chan = 0; chan < 2; ++chan) {
+            pre_main_pointers_[chan] = pre_main_buffers_[chan].data() + start_idx;
+            solo_pointers_[chan] = solo_buffers_[chan].data() + start_idx;
+        }
+    }
+
+    void Controller::updateSidePowers(std::array<double*, 2> side_pointers, const size_t num_samples) {
+        const auto num = static_cast<double>(num_samples);
+        const auto l_power = zldsp::vector::sum_sqr(side_pointers[0], num_samples) / num;
+        const auto r_power = zldsp::vector::sum_sqr(side_pointers[1], num_samples) / num;
+        side_powers_[0] = {l_power + r_power, l_power + r_power};
+        side_powers_[1] = {l_power, r_power};
+        side_powers_[2] = {r_power, l_power};
+        if (is_ms_on_ && c_ms_side_on_) {
+            // mid = (l + r) / 2, side = (l - r) / 2
+            const auto cross = zldsp::vector::dot_product(side_pointers[0], side_pointers[1], num_samples) / num;
+            const auto m_power = std::max(0.25 * (l_power + r_power + 2.0 * cross), 0.0);
+            const auto s_power = std::max(0.25 * (l_power + r_power - 2.0 * cross), 0.0);
+            side_powers_[3] = {m_power, s_power};
+            side_powers_[4] = {s_power, m_power};
+        } else {
+            side_powers_[3] = {l_power, r_power};
+            side_powers_[4] = {r_power, l_power};
+        }
+    }
+
+    void Controller::updateAGC(const size_t num_samples) {
+        const auto pre_power = pre_square_sum_ / static_cast<double>(num_samples);
+        const auto post_power = post_square_sum_ / static_cast<double>(num_samples);
+        constexpr double kMinAGCPower = 1e-12;
+        if (std::isfinite(pre_power) && std::isfinite(post_power)
+            && pre_power >= kMinAGCPower && post_power >= kMinAGCPower) {
+            c_agc_gain_linear_ = std::clamp(std::sqrt(pre_power) / std::sqrt(post_power), 1e-3, 1e3);
+            updateOutputGain();
+        }
+    }
+
+    template <bool bypass>
+    void Controller::processTileFront(std::array<double*, 2> main_pointers, std::array<double*, 2> side_pointers,
+                                      const size_t num_samples) {
         if (c_delay_on_) {
             delay_.process(main_pointers, num_samples);
         }
@@ -581,14 +720,13 @@ namespace zlp {
             }
         }
         if (c_loudness_matcher_on_) {
+            loudness_matcher_.setRealTime(!p_ref_.isNonRealtime());
             loudness_matcher_.processPre(main_pointers, num_samples);
         }
         if (c_agc_on_) {
-            pre_square_sum_ = 0.0;
             for (size_t chan = 0; chan < 2; chan++) {
                 pre_square_sum_ += zldsp::vector::sum_sqr(main_pointers[chan], num_samples);
             }
-            pre_square_sum_ /= static_cast<double>(num_samples);
         }
         switch (c_filter_structure_) {
         case kMinimum:
@@ -612,29 +750,31 @@ namespace zlp {
             break;
         }
         }
-        if (c_sgc_on_) {
+        // if nothing reads the signal between the static gain compensation and the output gain,
+        // they are applied in one pass
+        const auto fuse_gains = c_sgc_on_ && !c_loudness_matcher_on_ && !c_agc_on_;
+        if (c_sgc_on_ && !fuse_gains) {
             sgc_gain_.process(main_pointers, num_samples);
         }
         if (c_loudness_matcher_on_) {
             loudness_matcher_.processPost(main_pointers, num_samples);
         }
         if (c_agc_on_) {
-            double post_square_sum{0.0};
             for (size_t chan = 0; chan < 2; chan++) {
-                post_square_sum += zldsp::vector::sum_sqr(main_pointers[chan], num_samples);
-            }
-            post_square_sum /= static_cast<double>(num_samples);
-
-            constexpr double kMinAGCPower = 1e-12;
-            if (std::isfinite(pre_square_sum_) && std::isfinite(post_square_sum)
-                && pre_square_sum_ >= kMinAGCPower && post_square_sum >= kMinAGCPower) {
-                c_agc_gain_linear_ = std::clamp(
-                    std::sqrt(pre_square_sum_) / std::sqrt(post_square_sum), 1e-3, 1e3);
-                updateOutputGain();
+                post_square_sum_ += zldsp::vector::sum_sqr(main_pointers[chan], num_samples);
             }
         }
+    }
 
-        output_gain_.process(main_pointers, num_samples);
+    template <bool bypass>
+    void Controller::processTileBack(std::array<double*, 2> main_pointers, std::array<double*, 2> side_pointers,
+                                     const size_t num_samples) {
+        const auto fuse_gains = c_sgc_on_ && !c_loudness_matcher_on_ && !c_agc_on_;
+        if (fuse_gains) {
+            zldsp::gain::processProduct(std::array{&sgc_gain_, &output_gain_}, main_pointers, num_samples);
+        } else {
+            output_gain_.process(main_pointers, num_samples);
+        }
 
         if (c_agc_on_) {
             for (size_t chan = 0; chan < 2; chan++) {
@@ -709,6 +849,18 @@ namespace zlp {
 
     template void Controller::process<false>(std::array<double*, 2>, std::array<double*, 2>, size_t);
 
+    int Controller::useTimeSlice() {
+        // posting a message locks and writes to the message queue, so the audio thread leaves it to this thread
+        if (to_update_latency_.check()) {
+            triggerAsyncUpdate();
+        }
+        // the make-up gain only needs a few updates per second, the latency is polled at the same rate
+        if (loudness_matcher_on_.load(std::memory_order::relaxed)) {
+            loudness_matcher_.measure();
+        }
+        return 50;
+    }
+
     void Controller::handleAsyncUpdate() {
         p_ref_.setLatencySamples(correction_latency_.load(std::memory_order::relaxed)
             + delay_latency_.load(std::memory_order::relaxed));
@@ -729,7 +881,9 @@ namespace zlp {
         }
         if (is_ms_on_) {
             zldsp::splitter::InplaceMSSplitter<double>::split(main_pointers[0], main_pointers[1], num_samples);
-            zldsp::splitter::InplaceMSSplitter<double>::split(side_pointers[0], side_pointers[1], num_samples);
+            if (c_ms_side_on_) {
+                zldsp::splitter::InplaceMSSplitter<double>::split(side_pointers[0], side_pointers[1], num_samples);
+            }
 
             processOneChannelDynamic<DynamicFilterArrayType, should_check_parallel, should_be_parallel>(
                 dynamic_filters, 3, {&main_pointers[0], 1}, {&side_pointers[0], 1}, {&side_pointers[1], 1},
@@ -739,7 +893,9 @@ namespace zlp {
                 num_samples);
 
             zldsp::splitter::InplaceMSSplitter<double>::combine(main_pointers[0], main_pointers[1], num_samples);
-            zldsp::splitter::InplaceMSSplitter<double>::combine(side_pointers[0], side_pointers[1], num_samples);
+            if (c_ms_side_on_) {
+                zldsp::splitter::InplaceMSSplitter<double>::combine(side_pointers[0], side_pointers[1], num_samples);
+            }
         }
     }
 
@@ -757,29 +913,35 @@ namespace zlp {
             if (c_filter_status_[i] == kBypass) {
                 if (c_dynamic_on_[i]) {
                     const auto swap = dynamic_swap_[i].load(std::memory_order::relaxed);
+                    const auto side_power = side_powers_[lrms_idx][swap ? 1 : 0];
                     if (dynamic_bypass_[i].load(std::memory_order::relaxed)) {
                         processOneBandDynamic<true, true, true>(dynamic_filters, i, main_pointers,
-                                                                swap ? side_pointers2 : side_pointers1, num_samples);
+                                                                swap ? side_pointers2 : side_pointers1, side_power,
+                                                                num_samples);
                     } else {
                         processOneBandDynamic<true, true, false>(dynamic_filters, i, main_pointers,
-                                                                 swap ? side_pointers2 : side_pointers1, num_samples);
+                                                                 swap ? side_pointers2 : side_pointers1, side_power,
+                                                                 num_samples);
                     }
                 } else {
-                    processOneBandDynamic<true, false, false>(dynamic_filters, i, main_pointers, side_pointers1,
+                    processOneBandDynamic<true, false, false>(dynamic_filters, i, main_pointers, side_pointers1, 0.0,
                                                               num_samples);
                 }
             } else {
                 if (c_dynamic_on_[i]) {
                     const auto swap = dynamic_swap_[i].load(std::memory_order::relaxed);
+                    const auto side_power = side_powers_[lrms_idx][swap ? 1 : 0];
                     if (dynamic_bypass_[i].load(std::memory_order::relaxed)) {
                         processOneBandDynamic<false, true, true>(dynamic_filters, i, main_pointers,
-                                                                 swap ? side_pointers2 : side_pointers1, num_samples);
+                                                                 swap ? side_pointers2 : side_pointers1, side_power,
+                                                                 num_samples);
                     } else {
                         processOneBandDynamic<false, true, false>(dynamic_filters, i, main_pointers,
-                                                                  swap ? side_pointers2 : side_pointers1, num_samples);
+                                                                  swap ? side_pointers2 : side_pointers1, side_power,
+                                                                  num_samples);
                     }
                 } else {
-                    processOneBandDynamic<false, false, false>(dynamic_filters, i, main_pointers, side_pointers1,
+                    processOneBandDynamic<false, false, false>(dynamic_filters, i, main_pointers, side_pointers1, 0.0,
                                                                num_samples);
                 }
             }
@@ -790,6 +952,7 @@ namespace zlp {
     void Controller::processOneBandDynamic(DynamicFilterArrayType& dynamic_filters, const size_t i,
                                            const std::span<double*> main_pointers,
                                            const std::span<double*> side_pointers,
+                                           const double side_power,
                                            const size_t num_samples) {
         if constexpr (dynamic_on) {
             // copy side buffer
@@ -801,11 +964,7 @@ namespace zlp {
             // calculate side total loudness if dynamic relative is on
             double side_total_loudness = 0.0;
             if (c_dynamic_th_relative_[i]) {
-                for (size_t chan = 0; chan < side_pointers.size(); ++chan) {
-                    const auto side_sum_sqr = zldsp::vector::sum_sqr(side_copy_pointers_[chan], num_samples);
-                    side_total_loudness += side_sum_sqr / static_cast<double>(num_samples);
-                }
-                side_total_loudness = zldsp::chore::squareGainToDecibels(side_total_loudness);
+                side_total_loudness = zldsp::chore::squareGainToDecibels(side_power);
             }
             // process side filter
             side_filters_[i].process(side_copy_pointers_, num_samples);
@@ -829,45 +988,20 @@ namespace zlp {
                 }
                 }
             }
-            // calculate side histogram loudness if dynamic learn is on
-            if (c_dynamic_th_learn_[i]) {
-                double side_current_loudness = 0.0;
-                for (size_t chan = 0; chan < side_pointers.size(); ++chan) {
-                    const auto side_sum_sqr = zldsp::vector::sum_sqr(side_copy_pointers_[chan], num_samples);
-                    side_current_loudness += side_sum_sqr / static_cast<double>(num_samples);
-                }
-                side_current_loudness = zldsp::chore::squareGainToDecibels(side_current_loudness);
-                // update histograms
-                slow_histograms_[i].setDecay(std::pow(slow_hist_unit_decay_, static_cast<double>(num_samples)));
-                slow_histograms_[i].push(side_current_loudness - side_total_loudness);
-                slow_histograms_[i].getPercentiles(hist_percentiles_, hist_target_temp_, hist_results_);
-                learned_thresholds_[i].store(hist_results_[1],
-                                             std::memory_order::relaxed);
-                learned_knees_[i].store(std::max(0.5 * (hist_results_[2] - hist_results_[0]), 2.0),
-                                        std::memory_order::relaxed);
-
-                histograms_[i].setDecay(std::pow(hist_unit_decay_, static_cast<double>(num_samples)));
-                histograms_[i].push(side_current_loudness - side_total_loudness);
-                histograms_[i].getPercentiles(hist_percentiles_, hist_target_temp_, hist_results_);
-                dynamic_side_handlers_[i].setKnee<false>(
-                    std::max(0.5 * (hist_results_[2] - hist_results_[0]), 5.0));
-            } else if (c_editor_on_) {
-                double side_current_loudness = 0.0;
+            // accumulate the side loudness over the tiles, the histograms and the display take one value per block
+            if (c_dynamic_th_learn_[i] || c_editor_on_) {
                 for (size_t chan = 0; chan < side_pointers.size(); ++chan) {
-                    const auto side_sum_sqr = zldsp::vector::sum_sqr(side_copy_pointers_[chan], num_samples);
-                    side_current_loudness += side_sum_sqr / static_cast<double>(num_samples);
+                    side_square_sums_[i] += zldsp::vector::sum_sqr(side_copy_pointers_[chan], num_samples);
                 }
-                side_current_loudness = zldsp::chore::squareGainToDecibels(side_current_loudness);
-                dynamic_side_loudness_display_[i].store(side_current_loudness, std::memory_order::relaxed);
             }
-            // update actual threshold if required
+            // update actual threshold if required, the learned part comes from the previous blocks
             if (c_dynamic_th_learn_[i]) {
                 if (c_dynamic_th_relative_[i]) {
                     dynamic_side_handlers_[i].setThreshold(
-                        hist_results_[1] + side_total_loudness + c_dynamic_threshold_[i]);
+                        hist_medians_[i] + side_total_loudness + c_dynamic_threshold_[i]);
                 } else {
                     dynamic_side_handlers_[i].setThreshold(
-                        hist_results_[1] + c_dynamic_threshold_[i]);
+                        hist_medians_[i] + c_dynamic_threshold_[i]);
                 }
             } else if (c_dynamic_th_relative_[i]) {
                 dynamic_side_handlers_[i].setThreshold(
@@ -884,9 +1018,41 @@ namespace zlp {
             } else {
                 current_gains_[i].store(dynamic_side_handlers_[i].getCurrentGain(), std::memory_order::relaxed);
             }
+            if (is_last_tile_ && (c_dynamic_th_learn_[i] || c_editor_on_)) {
+                updateSideLoudness(i, side_power);
+            }
         }
     }
 
+    void Controller::updateSideLoudness(const size_t i, const double side_power) {
+        const auto side_current_loudness = zldsp::chore::squareGainToDecibels(
+            side_square_sums_[i] / static_cast<double>(block_num_samples_));
+        side_square_sums_[i] = 0.0;
+        if (!c_dynamic_th_learn_[i]) {
+            dynamic_side_loudness_display_[i].store(side_current_loudness, std::memory_order::relaxed);
+            return;
+        }
+        const auto side_total_loudness = c_dynamic_th_relative_[i]
+                                             ? zldsp::chore::squareGainToDecibels(side_power)
+                                             : 0.0;
+        const auto block_size = static_cast<double>(block_num_samples_);
+        // update histograms, the new threshold and knee apply from the next block on
+        slow_histograms_[i].setDecay(std::pow(slow_hist_unit_decay_, block_size));
+        slow_histograms_[i].push(side_current_loudness - side_total_loudness);
+        slow_histograms_[i].getPercentiles(hist_percentiles_, hist_target_temp_, hist_results_);
+        learned_thresholds_[i].store(hist_results_[1],
+                                     std::memory_order::relaxed);
+        learned_knees_[i].store(std::max(0.5 * (hist_results_[2] - hist_results_[0]), 2.0),
+                                std::memory_order::relaxed);
+
+        histograms_[i].setDecay(std::pow(hist_unit_decay_, block_size));
+        histograms_[i].push(side_current_loudness - side_total_loudness);
+        histograms_[i].getPercentiles(hist_percentiles_, hist_target_temp_, hist_results_);
+        hist_medians_[i] = hist_results_[1];
+        dynamic_side_handlers_[i].setKnee<false>(
+            std::max(0.5 * (hist_results_[2] - hist_results_[0]), 5.0));
+    }
+
     template <bool is_pre>
     void Controller::processParallelPrePost(std::span<double*> main_pointers, const size_t num_samples) {
         for (const size_t& i : not_off_indices_[0]) {
@@ -930,16 +1096,18 @@ namespace zlp {
         }
     }
 
-    void Controller::processCorrections(StereoFIRProcessor<double>& processor, std::span<double*> main_pointers,
+    void Controller::processCorrections(StereoFIRProcessor<double, kBandNum>& processor,
+                                        std::span<double*> main_pointers,
                                         size_t num_samples, bool bypass) {
         auto dispatch = [&]<size_t... Is>(std::index_sequence<Is...>) {
-            using FuncType = void (*)(StereoFIRProcessor<double>&, std::span<double*>, size_t, bool);
+            using FuncType = void (*)(StereoFIRProcessor<double, kBandNum>&, std::span<double*>, size_t, bool);
             static constexpr FuncType table[] = {
-                [](StereoFIRProcessor<double>& p, std::span<double*> m, size_t n, bool b) {
+                [](StereoFIRProcessor<double, kBandNum>& p, std::span<double*> m, size_t n, bool b) {
                     p.template process<(Is & 16) != 0, (Is & 8) != 0, (Is & 4) != 0, (Is & 2) != 0, (Is & 1) != 0>(m, n, b);
                 }...
             };
-            table[correction_mask_](processor, main_pointers, num_samples, bypass);
+            // skip the multiplications of corrections which are identity
+            table[correction_mask_ & processor.getNonIdentityMask()](processor, main_pointers, num_samples, bypass);
         };
         dispatch(std::make_index_sequence<32>{});
     }
@@ -37,6 +37,8 @@
 #include "../dsp/delay/integer_delay.hpp"
 
 #include "../chore/thread/notifier.hpp"
+#include "../chore/thread/realtime_check.hpp"
+#include "measurement_thread.hpp"
 
 namespace zlp {
     template <typename T, std::size_t N, typename... Args, std::size_t... I>
@@ -49,14 +51,32 @@ namespace zlp {
         return make_array_of_impl<T, N>(std::make_index_sequence<N>{}, std::forward<Args>(args)...);
     }
 
-    class Controller final : private juce::AsyncUpdater {
+    class Controller final : private juce::AsyncUpdater,
+                             private juce::TimeSliceClient {
     public:
         static constexpr size_t kFilterSize = 16;
+        static constexpr size_t kTileSize = 256;
 
         explicit Controller(juce::AudioProcessor& processor);
 
+        ~Controller() override;
+
         void prepare(double sample_rate, size_t max_num_samples);
 
+        /**
+         * apply pending parameter updates, must be called on the audio thread before process
+         */
+        void prepareBuffer();
+
+        /**
+         * whether any enabled consumer (dynamic bands or the analyzer) reads the side buffers
+         * only valid on the audio thread after prepareBuffer
+         * @return
+         */
+        [[nodiscard]] bool isSideON() const {
+            return c_side_on_;
+        }
+
         template <bool bypass = false>
         void process(std::array<double*, 2> main_pointers,
                      std::array<double*, 2> side_pointers,
@@ -152,6 +172,19 @@ namespace zlp {
             to_update_.signal();
         }
 
+        /**
+         * set the control interval of dynamic gains
+         * 1 updates the dynamic coefficients per sample, larger values sample the dynamic gain every
+         * control_interval samples and interpolate the coefficients in between
+         * @param control_interval
+         */
+        void setDynamicControlInterval(const size_t control_interval) {
+            dynamic_control_interval_.store(std::max(control_interval, static_cast<size_t>(1)),
+                                            std::memory_order::relaxed);
+            to_update_control_interval_.signal();
+            to_update_.signal();
+        }
+
         std::array<zldsp::filter::Empty, kBandNum>& getEmptyFilters() {
             return emptys_;
         }
@@ -172,6 +205,16 @@ namespace zlp {
             to_update_.signal();
         }
 
+        /**
+         * spread the FIR correction frames over the following hop to flatten the per-callback cost
+         * it adds one hop of latency to the correction
+         * @param is_on
+         */
+        void setFIRAmortised(const bool is_on) {
+            fir_amortised_.store(is_on, std::memory_order::relaxed);
+            to_update_.signal();
+        }
+
         auto& getAnalyzerSender() {
             return analyzer_sender_;
         }
@@ -289,6 +332,8 @@ namespace zlp {
         std::array<FilterStereo, kBandNum> c_lrms_{};
         zlchore::thread::Notifier to_update_lrms_{false};
         bool is_lr_on_{false}, is_ms_on_{false};
+        // whether side buffers are read by any consumer
+        bool c_side_on_{false}, c_ms_side_on_{false};
         // not off indices for stereo/l/r/m/s
         std::array<std::vector<size_t>, 5> not_off_indices_{};
         // empty filters for holding atomic parameters
@@ -332,39 +377,50 @@ namespace zlp {
         bool force_update_correction_{false};
         // update indices
         std::array<bool, kBandNum> res_update_flags_{};
+        // the bands whose corrections have changed in the current update
+        std::array<bool, kBandNum> correction_dirty_flags_{};
         // correction on indices for stereo/l/r/m/s (might duplicate)
         std::atomic<int> correction_latency_{0};
+        // the audio thread only signals a latency change, useTimeSlice posts it to the message thread
+        zlchore::thread::Notifier to_update_latency_{false};
         bool to_update_correction_indices_{false};
         std::vector<size_t> correction_on_total_{};
         std::array<std::vector<size_t>, 5> correction_on_indices_{};
         size_t correction_mask_{0};
+        std::atomic<bool> fir_amortised_{false};
+        bool c_fir_amortised_{false};
         // filters for calculating prototype response and biquad response
         std::array<zldsp::filter::Ideal<float, kFilterSize>, kBandNum> res_ideals_{};
         std::array<zldsp::filter::TDF<float, kFilterSize>, kBandNum> res_tdfs_{};
         // match correction
         std::unique_ptr<zldsp::fft::RFFT<float>> match_fft_;
         zldsp::filter::MatchCalculator<kBandNum, kFilterSize> match_calculator_;
-        StereoFIRProcessor<double> match_stereo_fir_{match_fft_, 9, 2};
+        StereoFIRProcessor<double, kBandNum> match_stereo_fir_{match_fft_, 9, 2};
         // mixed correction
         std::unique_ptr<zldsp::fft::RFFT<float>> mixed_fft_;
         zldsp::filter::MixedCalculator<kBandNum, kFilterSize> mixed_calculator_;
-        StereoFIRProcessor<double> mixed_stereo_fir_{mixed_fft_, 10, 16};
+        StereoFIRProcessor<double, kBandNum> mixed_stereo_fir_{mixed_fft_, 10, 16};
         // linear phase (zero phase) correction
         std::unique_ptr<zldsp::fft::RFFT<float>> zero_fft_;
         zldsp::filter::ZeroCalculator<kBandNum, kFilterSize> zero_calculator_;
-        StereoFIRProcessor<double> zero_stereo_fir_{zero_fft_, 13, 0};
+        StereoFIRProcessor<double, kBandNum> zero_stereo_fir_{zero_fft_, 13, 0};
 
         // filter dynamic flags
         std::array<std::atomic<bool>, kBandNum> dynamic_on_{};
         std::array<std::atomic<bool>, kBandNum> dynamic_bypass_{};
         std::array<bool, kBandNum> c_dynamic_on_{};
         zlchore::thread::Notifier to_update_dynamic_{false};
+        // dynamic control interval
+        std::atomic<size_t> dynamic_control_interval_{1};
+        zlchore::thread::Notifier to_update_control_interval_{false};
         // filter dynamic swap flags
         std::array<std::atomic<bool>, kBandNum> dynamic_swap_{};
         // dynamic related parameters
         std::array<zlchore::thread::Notifier, kBandNum> dynamic_th_update_{};
         std::array<std::atomic<bool>, kBandNum> dynamic_th_relative_{};
         std::array<bool, kBandNum> c_dynamic_th_relative_{};
+        // block-level side powers of {side_pointers1, side_pointers2} for each lrms index
+        std::array<std::array<double, 2>, 5> side_powers_{};
         std::array<std::atomic<bool>, kBandNum> dynamic_th_learn_{};
         std::array<bool, kBandNum> c_dynamic_th_learn_{};
         std::array<std::atomic<double>, kBandNum> dynamic_threshold_{};
@@ -385,6 +441,11 @@ namespace zlp {
         std::array<double, 3> hist_percentiles_{0.1, 0.5, 0.9};
         std::array<double, 3> hist_target_temp_{};
         std::array<double, 3> hist_results_{};
+        // the side loudness is accumulated over the tiles of a block, so the histograms see one value per block
+        std::array<double, kBandNum> side_square_sums_{};
+        std::array<double, kBandNum> hist_medians_{};
+        size_t block_num_samples_{1};
+        bool is_last_tile_{true};
         std::array<zldsp::histogram::Histogram<double>, kBandNum> histograms_
             = make_array_of<zldsp::histogram::Histogram<double>, kBandNum>(-80.0, 0.0, static_cast<size_t>(80));
         std::array<zldsp::histogram::Histogram<double>, kBandNum> slow_histograms_
@@ -428,12 +489,14 @@ namespace zlp {
         // auto gain compensation
         std::atomic<bool> agc_on_{false};
         bool c_agc_on_{false};
-        double pre_square_sum_{1.};
+        double pre_square_sum_{0.}, post_square_sum_{0.};
         double c_agc_gain_linear_{1.};
         // loudness matcher
         std::atomic<bool> loudness_matcher_on_{false};
         bool c_loudness_matcher_on_{false};
         zldsp::loudness::LUFSMatcher<double> loudness_matcher_{true};
+        // the loudness is measured on the shared measurement thread during real-time processing
+        juce::SharedResourcePointer<MeasurementThread> measurement_thread_;
         // makeup gain
         zlchore::thread::Notifier to_update_makeup_{false};
         std::atomic<double> makeup_gain_linear_{};
@@ -450,8 +513,6 @@ namespace zlp {
         bool c_delay_on_{false};
         zldsp::delay::IntegerDelay<double> delay_{};
 
-        void prepareBuffer();
-
         void prepareUIStatus();
 
         void prepareStatus();
@@ -460,6 +521,8 @@ namespace zlp {
 
         void prepareOneBandDynamics(size_t i);
 
+        void prepareControlInterval();
+
         void prepareLRMS();
 
         void prepareFilters();
@@ -472,8 +535,36 @@ namespace zlp {
 
         void prepareDynamicParameters();
 
+        void prepareSideConsumers();
+
         void handleAsyncUpdate() override;
 
+        int useTimeSlice() override;
+
+        void setTilePointers(size_t start_idx);
+
+        void updateSideLoudness(size_t i, double side_power);
+
+        void updateSidePowers(std::array<double*, 2> side_pointers, size_t num_samples);
+
+        void updateAGC(size_t num_samples);
+
+        /**
+         * process one tile from the delay up to the static gain compensation and loudness matcher
+         */
+        template <bool bypass = false>
+        void processTileFront(std::array<double*, 2> main_pointers,
+                              std::array<double*, 2> side_pointers,
+                              size_t num_samples);
+
+        /**
+         * process one tile from the output gain up to the corrections and phase flip
+         */
+        template <bool bypass = false>
+        void processTileBack(std::array<double*, 2> main_pointers,
+                             std::array<double*, 2> side_pointers,
+                             size_t num_samples);
+
         template <typename DynamicFilterArrayType, bool should_check_parallel = false, bool should_be_parallel = false>
         void processDynamic(DynamicFilterArrayType& dynamic_filters,
                             std::array<double*, 2> main_pointers,
@@ -494,6 +585,7 @@ namespace zlp {
                                    size_t i,
                                    std::span<double*> main_pointers,
                                    std::span<double*> side_pointers,
+                                   double side_power,
                                    size_t num_samples);
 
         template <bool is_pre>
@@ -502,7 +594,7 @@ namespace zlp {
         template <bool is_pre>
         void processParallelOneBandPrePost(size_t i, std::span<double*> main_pointers, size_t num_samples);
 
-        void processCorrections(StereoFIRProcessor<double>& processor, std::span<double*> main_pointers,
+        void processCorrections(StereoFIRProcessor<double, kBandNum>& processor, std::span<double*> main_pointers,
                                 size_t num_samples, bool bypass);
 
         template <bool force>
@@ -12,6 +12,8 @@
 #include <atomic>
 #include <juce_audio_processors/juce_audio_processors.h>
 
+#include "../../chore/thread/realtime_check.hpp"
+
 namespace zlp::juce_helper {
     /**
      * a helper class that run parameter updating on the message thread (async)
@@ -25,6 +27,7 @@ namespace zlp::juce_helper {
 
         void update(const float para_value) {
             value_.store(para_value, std::memory_order::relaxed);
+            zlchore::thread::checkRealtime("triggerAsyncUpdate");
             triggerAsyncUpdate();
         }
 
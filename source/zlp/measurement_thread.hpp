@@ -0,0 +1,37 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <juce_events/juce_events.h>
+
+namespace zlp {
+    /**
+     * a low priority thread shared by all processors in the host process for background measurements
+     * hold it with juce::SharedResourcePointer so that it lives as long as any processor
+     */
+    class MeasurementThread {
+    public:
+        MeasurementThread() {
+            thread_.startThread(juce::Thread::Priority::low);
+        }
+
+        ~MeasurementThread() {
+            thread_.stopThread(1000);
+        }
+
+        juce::TimeSliceThread& getThread() {
+            return thread_;
+        }
+
+    private:
+        juce::TimeSliceThread thread_{"zl_measurement"};
+    };
+}
@@ -14,15 +14,24 @@
 #include <span>
 #include <algorithm>
 #include <cmath>
+#include <bit>
+#include <array>
+#include <cassert>
 
 #include "../dsp/fft/zldsp_fft_include.hpp"
+#include "../dsp/fft/zldsp_fft_window_cache.hpp"
 #include "../dsp/vector/vector.hpp"
 #include "sample_rate_helper.hpp"
 
 namespace zlp {
     namespace hn = hwy::HWY_NAMESPACE;
 
-    template<typename FloatType>
+    /**
+     * the stereo FIR correction, an overlap-add STFT whose spectrum is multiplied with the band corrections
+     * @tparam FloatType
+     * @tparam kFilterNum the number of bands
+     */
+    template<typename FloatType, size_t kFilterNum>
     class StereoFIRProcessor {
     public:
         StereoFIRProcessor(std::unique_ptr<zldsp::fft::RFFT<float>> &fft,
@@ -42,23 +51,18 @@ namespace zlp {
             fft_size_ = static_cast<size_t>(1) << fft_order_;
             num_bin_ = fft_size_ / 2 + 1;
             hop_size_ = fft_size_ / overlap_;
-            latency_ = static_cast<int>(fft_size_);
+            latency_ = static_cast<int>(is_amortised_ ? fft_size_ + hop_size_ : fft_size_);
+            for (size_t stage = 0; stage < kNumStages; ++stage) {
+                stage_counts_[stage] = (stage + 1) * hop_size_ / (kNumStages + 1);
+            }
 
             fft_ = std::make_unique<zldsp::fft::RFFT<float>>(fft_order_);
 
-            window1_.resize(fft_size_);
-            window2_.resize(fft_size_);
-            window_bypass_.resize(fft_size_);
-            zldsp::fft::createPeriodicHanning<float>(window1_, 2.f / static_cast<float>(fft_size_));
-            const auto v_window2_scale = hn::Set(d, static_cast<float>(fft_size_) / 3.f);
-            const auto v_bypass_scale = hn::Set(d, static_cast<float>(fft_size_ * fft_size_) / 6.f);
-            for (size_t i = 0; i < fft_size_; i += lanes) {
-                const auto v_window1 = hn::Load(d, window1_.data() + i);
-                const auto v_window2 = hn::Mul(v_window1, v_window2_scale);
-                hn::Store(v_window2, d, window2_.data() + i);
-                const auto v_window_bypass = hn::Mul(hn::Mul(v_window1, v_window1), v_bypass_scale);
-                hn::Store(v_window_bypass, d, window_bypass_.data() + i);
-            }
+            // window2 = window1 * N / 3, window_bypass = window1^2 * N^2 / 6
+            window1_ = zldsp::fft::getSharedWindow(fft_size_, zldsp::fft::WindowType::kHanning,
+                                                   2.f / static_cast<float>(fft_size_));
+            window2_ = zldsp::fft::getSharedWindow(fft_size_, zldsp::fft::WindowType::kHanning, 2.f / 3.f);
+            window_bypass_ = zldsp::fft::getSharedWindow(fft_size_, zldsp::fft::WindowType::kHanningSqr, 2.f / 3.f);
 
             for (auto &fifo: input_fifo_) fifo.resize(fft_size_);
             for (auto &fifo: output_fifo_) fifo.resize(fft_size_);
@@ -75,11 +79,37 @@ namespace zlp {
                 buf.resize(num_bin_);
                 std::ranges::fill(buf, 0.f);
             }
+            for (auto &tree: trees_) {
+                // the calculators are resized as well, so the next update rebuilds the tree
+                tree.indices.clear();
+                tree.indices.reserve(kFilterNum);
+                tree.nodes_real.fill(nullptr);
+                tree.nodes_imag.fill(nullptr);
+                tree.slots.fill(kNoSlot);
+                tree.dirty.fill(false);
+            }
+            for (auto &buf: product_reals_) buf.resize(num_bin_);
+            for (auto &buf: product_imags_) buf.resize(num_bin_);
+            num_slots_ = 0;
+            updateKinds();
+        }
+
+        /**
+         * spread the work of each frame over the callbacks of the next hop, at the cost of one extra hop of latency
+         * it changes the latency and resets the processor
+         * @param is_amortised
+         */
+        void setAmortised(const bool is_amortised) {
+            is_amortised_ = is_amortised;
+            latency_ = static_cast<int>(is_amortised_ ? fft_size_ + hop_size_ : fft_size_);
+            reset();
         }
 
         void reset() {
             pos_ = 0;
             count_ = 0;
+            stage_ = kNumStages;
+            has_frame_ = false;
             for (auto &fifo: input_fifo_) {
                 std::ranges::fill(fifo, 0.f);
             }
@@ -91,57 +121,71 @@ namespace zlp {
             }
         }
 
+        /**
+         * update the corrections from the band corrections of the calculators
+         * the product of each type is kept in a segment tree, so a change of one band costs log2(kFilterNum) multiplies
+         * @param calculators_real
+         * @param calculators_imag
+         * @param on_indices the bands of each type, each band belongs to at most one type
+         * @param dirty_flags the bands whose corrections have changed, empty to rebuild all products
+         */
         void updateCorrection(std::span<zldsp::vector::aligned_vector<float>> calculators_real,
                               std::span<zldsp::vector::aligned_vector<float>> calculators_imag,
-                              const std::array<std::vector<size_t>, 5> &on_indices) {
+                              const std::array<std::vector<size_t>, 5> &on_indices,
+                              std::span<const bool> dirty_flags = {}) {
+            // the trees share the product buffers, so if the bands of any type have changed, all trees are rebuilt
+            bool is_rebuilt = dirty_flags.empty();
+            for (size_t type = 0; type < 5 && !is_rebuilt; ++type) {
+                is_rebuilt = on_indices[type] != trees_[type].indices;
+            }
+            if (is_rebuilt) {
+                num_slots_ = 0;
+            }
             for (size_t type = 0; type < 5; ++type) {
-                if (on_indices[type].empty()) {
-                    std::ranges::fill(correction_real_[type], 1.f);
-                    std::ranges::fill(correction_imag_[type], 0.f);
-                    continue;
-                }
-                bool is_first = true;
-                for (const size_t &idx: on_indices[type]) {
-                    if (is_first) {
-                        zldsp::vector::copy(correction_real_[type].data(), calculators_real[idx].data(), num_bin_);
-                        zldsp::vector::copy(correction_imag_[type].data(), calculators_imag[idx].data(), num_bin_);
-                        is_first = false;
-                    } else {
-                        for (size_t i = 0; i < num_bin_ - 1; i += lanes) {
-                            const auto t_real_v = hn::Load(d, calculators_real[idx].data() + i);
-                            const auto t_imag_v = hn::Load(d, calculators_imag[idx].data() + i);
-                            const auto cor_real_v = hn::Load(d, correction_real_[type].data() + i);
-                            const auto cor_imag_v = hn::Load(d, correction_imag_[type].data() + i);
-
-                            const auto out_real_v = hn::NegMulAdd(t_imag_v, cor_imag_v, hn::Mul(t_real_v, cor_real_v));
-                            const auto out_imag_v = hn::MulAdd(t_real_v, cor_imag_v, hn::Mul(t_imag_v, cor_real_v));
-
-                            hn::Store(out_real_v, d, correction_real_[type].data() + i);
-                            hn::Store(out_imag_v, d, correction_imag_[type].data() + i);
-                        }
-                        const auto nyq_t_real = calculators_real[idx].back();
-                        const auto nyq_t_imag = calculators_imag[idx].back();
-                        const auto nyq_c_real = correction_real_[type].back();
-                        const auto nyq_c_imag = correction_imag_[type].back();
-                        correction_real_[type].back() = nyq_c_real * nyq_t_real - nyq_c_imag * nyq_t_imag;
-                        correction_imag_[type].back() = nyq_c_real * nyq_t_imag + nyq_c_imag * nyq_t_real;
+                auto &tree{trees_[type]};
+                const auto &indices{on_indices[type]};
+                if (is_rebuilt) {
+                    tree.indices.assign(indices.begin(), indices.end());
+                    for (size_t j = 0; j < kNumLeaves; ++j) {
+                        const auto is_on = j < indices.size();
+                        tree.nodes_real[kNumLeaves + j] = is_on ? calculators_real[indices[j]].data() : nullptr;
+                        tree.nodes_imag[kNumLeaves + j] = is_on ? calculators_imag[indices[j]].data() : nullptr;
                     }
-                    for (size_t w_idx = start_idx_; w_idx < num_bin_; ++w_idx) {
-                        const auto re = correction_real_[type][w_idx];
-                        const auto im = correction_imag_[type][w_idx];
-                        if (const auto abs_sqr = re * re + im * im; abs_sqr > 1e6f) {
-                            const auto scale = 1000.f / std::sqrt(abs_sqr);
-                            correction_real_[type][w_idx] *= scale;
-                            correction_imag_[type][w_idx] *= scale;
+                    tree.slots.fill(kNoSlot);
+                    std::ranges::fill(tree.dirty, true);
+                } else {
+                    bool is_dirty = false;
+                    for (size_t j = 0; j < indices.size(); ++j) {
+                        if (!dirty_flags[indices[j]]) { continue; }
+                        is_dirty = true;
+                        for (size_t k = (kNumLeaves + j) / 2; k > 0 && !tree.dirty[k]; k /= 2) {
+                            tree.dirty[k] = true;
                         }
                     }
+                    if (!is_dirty) { continue; }
                 }
+                for (size_t k = kNumLeaves - 1; k > 0; --k) {
+                    if (tree.dirty[k]) {
+                        updateNode(tree, k);
+                        tree.dirty[k] = false;
+                    }
+                }
+                if (tree.nodes_real[1] == nullptr) {
+                    std::ranges::fill(correction_real_[type], 1.f);
+                    std::ranges::fill(correction_imag_[type], 0.f);
+                    continue;
+                }
+                zldsp::vector::copy(correction_real_[type].data(), tree.nodes_real[1], num_bin_);
+                zldsp::vector::copy(correction_imag_[type].data(), tree.nodes_imag[1], num_bin_);
+                // the root may alias a single band, so clamp it again
+                clampCorrection(correction_real_[type].data(), correction_imag_[type].data());
                 const auto last_real = correction_real_[type].back();
                 const auto last_imag = correction_imag_[type].back();
                 const auto last_abs = std::sqrt(last_real * last_real + last_imag * last_imag);
                 correction_real_[type].back() = last_real > 0.f ? last_abs : -last_abs;
                 correction_imag_[type].back() = 0.f;
             }
+            updateKinds();
         }
 
         template<bool has_stereo, bool has_l, bool has_r, bool has_m, bool has_s>
@@ -157,11 +201,27 @@ namespace zlp {
                 count_ += 1;
                 if (count_ == hop_size_) {
                     count_ = 0;
-                    processFrame<has_stereo, has_l, has_r, has_m, has_s>(bypass);
+                    if (is_amortised_) {
+                        // finish the previous frame one hop late, then start the next one
+                        finishFrame<has_stereo, has_l, has_r, has_m, has_s>();
+                        captureFrame(bypass);
+                    } else {
+                        processFrame<has_stereo, has_l, has_r, has_m, has_s>(bypass);
+                    }
+                } else if (stage_ < kNumStages && count_ == stage_counts_[stage_]) {
+                    runStage<has_stereo, has_l, has_r, has_m, has_s>(stage_);
+                    stage_ += 1;
                 }
             }
         }
 
+        /**
+         * get the mask of corrections which are not identity, with the same bits as the template arguments of process()
+         * (stereo: 16, left: 8, right: 4, mid: 2, side: 1)
+         * @return
+         */
+        [[nodiscard]] size_t getNonIdentityMask() const { return non_identity_mask_; }
+
         [[nodiscard]] int getLatency() const { return latency_; }
 
         [[nodiscard]] size_t getNumBin() const { return num_bin_; }
@@ -171,7 +231,7 @@ namespace zlp {
         static constexpr size_t lanes = hn::MaxLanes(d);
 
         std::unique_ptr<zldsp::fft::RFFT<float>> &fft_;
-        zldsp::vector::aligned_vector<float> window1_, window2_, window_bypass_;
+        zldsp::fft::SharedWindow window1_, window2_, window_bypass_;
 
         size_t fft_order_, fft_size_, num_bin_, hop_size_;
         size_t default_fft_order_, start_idx_;
@@ -187,33 +247,130 @@ namespace zlp {
 
         std::array<zldsp::vector::aligned_vector<float>, 5> correction_real_, correction_imag_;
 
+        enum class CorrectionKind {
+            kIdentity, kGain, kGeneral
+        };
+
+        // the maximum deviation (relative to the gain) of a correction which is still treated as a pure gain
+        static constexpr float kGainTolerance = 1e-4f;
+        std::array<CorrectionKind, 5> kinds_{};
+        std::array<float, 5> gains_{};
+        size_t non_identity_mask_{0};
+        // if all corrections are identity or pure gains, they reduce to a 2x2 matrix and the STFT is skipped
+        bool is_gain_only_{true};
+        bool is_identity_{true};
+        std::array<float, 4> gain_matrix_{1.f, 0.f, 0.f, 1.f};
+
+        // the number of leaves of the product trees, a power of two which can hold all bands
+        static constexpr size_t kNumLeaves = std::bit_ceil(kFilterNum);
+
+        static constexpr size_t kNoSlot = kNumLeaves;
+
+        /**
+         * a segment tree of the band corrections of one type
+         * node k is the product of node 2k and node 2k+1, leaves point to the calculators
+         * nullptr stands for identity, and a node with only one non-identity child aliases that child
+         * only a node with two non-identity children holds a product, in a slot of the shared product buffers
+         */
+        struct ProductTree {
+            std::vector<size_t> indices;
+            std::array<const float *, 2 * kNumLeaves> nodes_real{}, nodes_imag{};
+            std::array<size_t, kNumLeaves> slots{};
+            std::array<bool, kNumLeaves> dirty{};
+        };
+
+        std::array<ProductTree, 5> trees_;
+        // a tree of m bands holds m - 1 products, so kFilterNum slots cover all trees as each band has one type
+        std::array<zldsp::vector::aligned_vector<float>, kFilterNum> product_reals_, product_imags_;
+        size_t num_slots_{0};
+
         int latency_{0};
 
+        // the frame is processed in stages: forward L, forward R, spectrum, backward L, backward R
+        static constexpr size_t kNumStages = 5;
+        bool is_amortised_{false};
+        // the count at which each stage of an amortised frame runs, spread evenly over one hop
+        std::array<size_t, kNumStages> stage_counts_{};
+        size_t stage_{kNumStages};
+        bool has_frame_{false};
+        // whether the captured frame goes through the STFT, and whether it needs the gain matrix
+        bool frame_is_spectral_{false};
+        bool frame_has_gain_{false};
+
         template<bool has_stereo, bool has_l, bool has_r, bool has_m, bool has_s>
         void processFrame(const bool bypass) {
+            captureFrame(bypass);
+            for (size_t stage = 0; stage < kNumStages; ++stage) {
+                runStage<has_stereo, has_l, has_r, has_m, has_s>(stage);
+            }
+            overlapAdd();
+            stage_ = kNumStages;
+            has_frame_ = false;
+        }
+
+        template<bool has_stereo, bool has_l, bool has_r, bool has_m, bool has_s>
+        void finishFrame() {
+            if (!has_frame_) {
+                return;
+            }
+            for (; stage_ < kNumStages; ++stage_) {
+                runStage<has_stereo, has_l, has_r, has_m, has_s>(stage_);
+            }
+            overlapAdd();
+        }
+
+        void captureFrame(const bool bypass) {
             for (size_t chan = 0; chan < 2; ++chan) {
                 zldsp::vector::copy(fft_in_[chan].data(), input_fifo_[chan].data() + pos_, fft_size_ - pos_);
                 if (pos_ > 0) {
                     zldsp::vector::copy(fft_in_[chan].data() + fft_size_ - pos_, input_fifo_[chan].data(), pos_);
                 }
             }
+            frame_is_spectral_ = !bypass && !is_gain_only_;
+            frame_has_gain_ = !bypass && !is_identity_;
+            has_frame_ = true;
+            stage_ = 0;
+        }
 
-            if (!bypass) {
-                multiplyWithWindow(fft_in_[0].data(), fft_in_[1].data(), window1_.data());
-                for (size_t chan = 0; chan < 2; ++chan) {
-                    fft_->forward(fft_in_[chan].data(), {fft_out_real_[chan].data(), fft_out_imag_[chan].data()}); // NOLINT
+        template<bool has_stereo, bool has_l, bool has_r, bool has_m, bool has_s>
+        void runStage(const size_t stage) {
+            if (!frame_is_spectral_) {
+                if (stage == 0) {
+                    // the bypass window reconstructs the delayed input, so the latency stays the same
+                    multiplyWithWindow(fft_in_[0].data(), fft_in_[1].data(), window_bypass_->data());
+                    if (frame_has_gain_) {
+                        multiplyWithGainMatrix(fft_in_[0].data(), fft_in_[1].data());
+                    }
                 }
-
-                processSpectrum<has_stereo, has_l, has_r, has_m, has_s>();
-
-                for (size_t chan = 0; chan < 2; ++chan) {
-                    fft_->backward({fft_out_real_[chan].data(), fft_out_imag_[chan].data()}, fft_in_[chan].data()); // NOLINT
+                return;
+            }
+            switch (stage) {
+                case 0: {
+                    multiplyWithWindow(fft_in_[0].data(), fft_in_[1].data(), window1_->data());
+                    fft_->forward(fft_in_[0].data(), {fft_out_real_[0].data(), fft_out_imag_[0].data()}); // NOLINT
+                    break;
+                }
+                case 1: {
+                    fft_->forward(fft_in_[1].data(), {fft_out_real_[1].data(), fft_out_imag_[1].data()}); // NOLINT
+                    break;
+                }
+                case 2: {
+                    processSpectrum<has_stereo, has_l, has_r, has_m, has_s>();
+                    break;
+                }
+                case 3: {
+                    fft_->backward({fft_out_real_[0].data(), fft_out_imag_[0].data()}, fft_in_[0].data()); // NOLINT
+                    break;
+                }
+                default: {
+                    fft_->backward({fft_out_real_[1].data(), fft_out_imag_[1].data()}, fft_in_[1].data()); // NOLINT
+                    multiplyWithWindow(fft_in_[0].data(), fft_in_[1].data(), window2_->data());
+                    break;
                 }
-                multiplyWithWindow(fft_in_[0].data(), fft_in_[1].data(), window2_.data());
-            } else {
-                multiplyWithWindow(fft_in_[0].data(), fft_in_[1].data(), window_bypass_.data());
             }
+        }
 
+        void overlapAdd() {
             for (size_t chan = 0; chan < 2; ++chan) {
                 for (size_t i = 0; i < pos_; ++i) {
                     output_fifo_[chan][i] += fft_in_[chan][i + fft_size_ - pos_];
@@ -376,6 +533,130 @@ namespace zlp {
             }
         }
 
+        void updateNode(ProductTree &tree, const size_t k) {
+            const auto *l_real = tree.nodes_real[2 * k];
+            const auto *l_imag = tree.nodes_imag[2 * k];
+            const auto *r_real = tree.nodes_real[2 * k + 1];
+            const auto *r_imag = tree.nodes_imag[2 * k + 1];
+            if (l_real == nullptr || r_real == nullptr) {
+                tree.nodes_real[k] = l_real == nullptr ? r_real : l_real;
+                tree.nodes_imag[k] = l_real == nullptr ? r_imag : l_imag;
+                return;
+            }
+            if (tree.slots[k] == kNoSlot) {
+                // the slots are handed out while the trees are rebuilt, later updates keep them
+                assert(num_slots_ < kFilterNum);
+                tree.slots[k] = num_slots_;
+                num_slots_ += 1;
+            }
+            auto *out_real = product_reals_[tree.slots[k]].data();
+            auto *out_imag = product_imags_[tree.slots[k]].data();
+            size_t i = 0;
+            for (; i + lanes <= num_bin_; i += lanes) {
+                const auto l_real_v = hn::LoadU(d, l_real + i);
+                const auto l_imag_v = hn::LoadU(d, l_imag + i);
+                const auto r_real_v = hn::LoadU(d, r_real + i);
+                const auto r_imag_v = hn::LoadU(d, r_imag + i);
+                hn::StoreU(hn::NegMulAdd(l_imag_v, r_imag_v, hn::Mul(l_real_v, r_real_v)), d, out_real + i);
+                hn::StoreU(hn::MulAdd(l_real_v, r_imag_v, hn::Mul(l_imag_v, r_real_v)), d, out_imag + i);
+            }
+            for (; i < num_bin_; ++i) {
+                out_real[i] = l_real[i] * r_real[i] - l_imag[i] * r_imag[i];
+                out_imag[i] = l_real[i] * r_imag[i] + l_imag[i] * r_real[i];
+            }
+            clampCorrection(out_real, out_imag);
+            tree.nodes_real[k] = out_real;
+            tree.nodes_imag[k] = out_imag;
+        }
+
+        /**
+         * limit the magnitude of the correction above start_idx to 60 dB
+         */
+        void clampCorrection(float *c_real, float *c_imag) const {
+            for (size_t w_idx = start_idx_; w_idx < num_bin_; ++w_idx) {
+                const auto re = c_real[w_idx];
+                const auto im = c_imag[w_idx];
+                if (const auto abs_sqr = re * re + im * im; abs_sqr > 1e6f) {
+                    const auto scale = 1000.f / std::sqrt(abs_sqr);
+                    c_real[w_idx] *= scale;
+                    c_imag[w_idx] *= scale;
+                }
+            }
+        }
+
+        /**
+         * classify each correction as identity, pure gain or general
+         */
+        void updateKinds() {
+            non_identity_mask_ = 0;
+            is_gain_only_ = true;
+            for (size_t type = 0; type < 5; ++type) {
+                kinds_[type] = classify(correction_real_[type], correction_imag_[type], gains_[type]);
+                if (kinds_[type] != CorrectionKind::kIdentity) {
+                    non_identity_mask_ |= static_cast<size_t>(16) >> type;
+                }
+                if (kinds_[type] == CorrectionKind::kGeneral) {
+                    is_gain_only_ = false;
+                }
+            }
+            is_identity_ = non_identity_mask_ == 0;
+            // stereo & left & right scale each channel, mid & side scale the sum and the difference
+            const auto l_gain = gains_[0] * gains_[1];
+            const auto r_gain = gains_[0] * gains_[2];
+            const auto sum_gain = 0.5f * (gains_[3] + gains_[4]);
+            const auto diff_gain = 0.5f * (gains_[3] - gains_[4]);
+            gain_matrix_ = {sum_gain * l_gain, diff_gain * r_gain, diff_gain * l_gain, sum_gain * r_gain};
+        }
+
+        static CorrectionKind classify(const zldsp::vector::aligned_vector<float> &c_real,
+                                       const zldsp::vector::aligned_vector<float> &c_imag,
+                                       float &gain) {
+            if (c_real.empty()) {
+                gain = 1.f;
+                return CorrectionKind::kIdentity;
+            }
+            gain = c_real[0];
+            const auto tolerance = kGainTolerance * std::abs(gain);
+            if (!(tolerance > 0.f)) {
+                gain = 0.f;
+                return CorrectionKind::kGeneral;
+            }
+            const auto v_gain = hn::Set(d, gain);
+            auto v_max_dev = hn::Zero(d);
+            size_t i = 0;
+            for (; i + lanes <= c_real.size(); i += lanes) {
+                const auto v_real_dev = hn::Abs(hn::Sub(hn::LoadU(d, c_real.data() + i), v_gain));
+                const auto v_imag_dev = hn::Abs(hn::LoadU(d, c_imag.data() + i));
+                v_max_dev = hn::Max(v_max_dev, hn::Max(v_real_dev, v_imag_dev));
+            }
+            auto max_dev = hn::ReduceMax(d, v_max_dev);
+            for (; i < c_real.size(); ++i) {
+                max_dev = std::max(max_dev, std::max(std::abs(c_real[i] - gain), std::abs(c_imag[i])));
+            }
+            if (!(max_dev <= tolerance)) {
+                gain = 0.f;
+                return CorrectionKind::kGeneral;
+            }
+            if (std::abs(gain - 1.f) <= kGainTolerance) {
+                gain = 1.f;
+                return CorrectionKind::kIdentity;
+            }
+            return CorrectionKind::kGain;
+        }
+
+        void multiplyWithGainMatrix(float * HWY_RESTRICT l_ptr, float * HWY_RESTRICT r_ptr) const {
+            const auto v_a = hn::Set(d, gain_matrix_[0]);
+            const auto v_b = hn::Set(d, gain_matrix_[1]);
+            const auto v_c = hn::Set(d, gain_matrix_[2]);
+            const auto v_d = hn::Set(d, gain_matrix_[3]);
+            for (size_t i = 0; i < fft_size_; i += lanes) {
+                const auto v_l = hn::Load(d, l_ptr + i);
+                const auto v_r = hn::Load(d, r_ptr + i);
+                hn::Store(hn::MulAdd(v_a, v_l, hn::Mul(v_b, v_r)), d, l_ptr + i);
+                hn::Store(hn::MulAdd(v_c, v_l, hn::Mul(v_d, v_r)), d, r_ptr + i);
+            }
+        }
+
         void multiplyWithWindow(float * HWY_RESTRICT in1_ptr,
                                 float * HWY_RESTRICT in2_ptr,
                                 const float * HWY_RESTRICT window_ptr) const {
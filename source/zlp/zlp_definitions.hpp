@@ -301,6 +301,29 @@ namespace zlp {
         static constexpr auto kDefaultV = 0.f;
     };
 
+    class PDynamicControl : public ChoiceParameters<PDynamicControl> {
+    public:
+        static constexpr auto kID = "total_dynamic_control";
+        static constexpr auto kName = "Dynamic Control";
+        inline static const auto kChoices = juce::StringArray{
+            "Per Sample", "16 Samples", "64 Samples"
+        };
+        // the control interval of each choice
+        static constexpr std::array<size_t, 3> kIntervals{1, 16, 64};
+        static constexpr int kDefaultI = 0;
+    };
+
+    class PFIRSchedule : public ChoiceParameters<PFIRSchedule> {
+    public:
+        static constexpr auto kID = "total_fir_schedule";
+        static constexpr auto kName = "FIR Schedule";
+        // spread each correction frame over the next hop, at the cost of one extra hop of latency
+        inline static const auto kChoices = juce::StringArray{
+            "Per Hop", "Spread"
+        };
+        static constexpr int kDefaultI = 0;
+    };
+
     // band parameters
     class PFilterStatus : public ChoiceParameters<PFilterStatus> {
     public:
@@ -538,7 +561,7 @@ namespace zlp {
         layout.add(PFilterStructure::get(), PExtSide::get(), PBypass::get(),
                    POutputGain::get(), PGainScale::get(),
                    PAutoGain::get(), PStaticGain::get(), PPhaseFlip::get(),
-                   PLookahead::get());
+                   PLookahead::get(), PDynamicControl::get(false), PFIRSchedule::get(false));
         for (size_t i = 0; i < kBandNum; ++i) {
             const auto suffix = std::to_string(i);
             layout.add(PFilterStatus::get(suffix),
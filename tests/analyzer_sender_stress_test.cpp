@@ -0,0 +1,131 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+#include <array>
+#include <atomic>
+#include <cstdio>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include "test_helper.hpp"
+#include "dsp/analyzer/analyzer_base/analyzer_sender_base.hpp"
+
+namespace {
+    constexpr size_t kNum = 2;
+    using Sender = zldsp::analyzer::AnalyzerSenderBase<double, kNum>;
+
+    /**
+     * check that a pinned generation is consistent and that every ready sample was pushed into it
+     * the sender marks each sample with the id of the generation it was pushed into
+     */
+    bool readGeneration(Sender::Generation& generation) {
+        bool is_consistent = true;
+        for (size_t i = 0; i < kNum; ++i) {
+            is_consistent = is_consistent && generation.sample_fifos[i].size() == generation.num_channels[i];
+            for (const auto& fifo : generation.sample_fifos[i]) {
+                is_consistent = is_consistent
+                    && fifo.size() == static_cast<size_t>(generation.abstract_fifo.getCapacity());
+            }
+        }
+        if (!is_consistent) {
+            return false;
+        }
+        const auto num_ready = generation.abstract_fifo.getNumReady();
+        const auto range = generation.abstract_fifo.prepareToRead(num_ready);
+        const auto marker = static_cast<float>(generation.id);
+        for (size_t i = 0; i < kNum; ++i) {
+            for (const auto& fifo : generation.sample_fifos[i]) {
+                for (int j = 0; j < range.block_size1; ++j) {
+                    is_consistent = is_consistent && fifo[static_cast<size_t>(range.start_index1 + j)] == marker;
+                }
+                for (int j = 0; j < range.block_size2; ++j) {
+                    is_consistent = is_consistent && fifo[static_cast<size_t>(range.start_index2 + j)] == marker;
+                }
+            }
+        }
+        generation.abstract_fifo.finishRead(num_ready);
+        return is_consistent;
+    }
+}
+
+int main() {
+    constexpr size_t kNumPrepares = 2000;
+    constexpr size_t kNumBlocksPerPrepare = 8;
+    constexpr size_t kMaxNumSamples = 256;
+
+    Sender sender;
+    sender.setON(0, true);
+    sender.setON(1, true);
+
+    std::atomic<bool> is_writing{true};
+    std::atomic<int> num_inconsistent{0};
+    std::atomic<int> num_acquired{0};
+
+    // the reader stands in for the editor-side workers, which pin a generation while the sender republishes
+    std::thread reader([&]() {
+        while (is_writing.load()) {
+            auto* generation = sender.tryAcquire();
+            if (generation == nullptr) {
+                continue;
+            }
+            if (!readGeneration(*generation)) {
+                num_inconsistent.fetch_add(1);
+            }
+            num_acquired.fetch_add(1);
+            Sender::release(generation);
+        }
+    });
+
+    std::array<std::vector<double>, 2> buffers;
+    for (auto& buffer : buffers) {
+        buffer.resize(kMaxNumSamples);
+    }
+    std::array<double*, 2> pointers{buffers[0].data(), buffers[1].data()};
+    for (size_t k = 0; k < kNumPrepares; ++k) {
+        // alternate sample rates and channel counts, so each generation has a different layout
+        const auto sample_rate = (k & 1) == 0 ? 44100.0 : 96000.0;
+        const std::array<size_t, kNum> num_channels{1 + (k & 1), 2 - (k & 1)};
+        sender.prepare(sample_rate, kMaxNumSamples, num_channels, 0.01 + 0.01 * static_cast<double>(k % 3));
+        ZL_CHECK(sender.getSampleRate() == sample_rate);
+        ZL_CHECK(sender.getNumChannels() == num_channels);
+
+        const auto marker = static_cast<double>(k + 1);
+        for (auto& buffer : buffers) {
+            std::fill(buffer.begin(), buffer.end(), marker);
+        }
+        for (size_t block = 0; block < kNumBlocksPerPrepare; ++block) {
+            sender.process({std::span<double*>(pointers.data(), num_channels[0]),
+                            std::span<double*>(pointers.data(), num_channels[1])},
+                           kMaxNumSamples);
+        }
+    }
+    is_writing.store(false);
+    reader.join();
+
+    std::printf("acquired %d generations, %d inconsistent\n", num_acquired.load(), num_inconsistent.load());
+    ZL_CHECK(num_inconsistent.load() == 0);
+
+    // a stalled reader must neither block prepare() nor see its pinned generation change underneath it
+    auto* stalled = sender.tryAcquire();
+    ZL_CHECK(stalled != nullptr);
+    const auto stalled_id = stalled->id;
+    const auto stalled_channels = stalled->num_channels;
+    for (size_t k = 0; k < 4; ++k) {
+        sender.prepare(48000.0, kMaxNumSamples, {2, 2}, 0.02);
+    }
+    ZL_CHECK(stalled->id == stalled_id);
+    ZL_CHECK(stalled->num_channels == stalled_channels);
+    ZL_CHECK(readGeneration(*stalled));
+    Sender::release(stalled);
+    auto* latest = sender.tryAcquire();
+    ZL_CHECK(latest != nullptr && latest->id == stalled_id + 4);
+    Sender::release(latest);
+    return zltest::finish();
+}
@@ -0,0 +1,108 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <numbers>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "test_helper.hpp"
+#include "dsp/filter/dynamic_filter/dynamic_tdf.hpp"
+
+namespace {
+    using TDF = zldsp::filter::TDF<double, 16>;
+
+    /**
+     * expose the dynamic loop of DynamicBase, so it can be driven with a known dynamic gain
+     */
+    class ControlRateProbe final : public zldsp::filter::DynamicBase<TDF, double> {
+    public:
+        explicit ControlRateProbe(zldsp::filter::DynamicSideHandler<double>& handler)
+            : zldsp::filter::DynamicBase<TDF, double>(handler) {
+        }
+
+        void run(std::span<double*> main_buffer, std::span<double*> side_buffer, const size_t num_samples) {
+            this->template internalProcess<2>(main_buffer, side_buffer, num_samples);
+        }
+    };
+
+    std::vector<double> runProbe(const size_t control_interval,
+                                 const std::vector<double>& input, const std::vector<double>& gains) {
+        constexpr size_t kBlockSize = 512;
+        zldsp::filter::DynamicSideHandler<double> handler;
+        ControlRateProbe probe{handler};
+        probe.prepare(48000.0, 1, kBlockSize);
+        probe.getFilter().forceUpdate({zldsp::filter::kPeak, 2, 1000.0, 0.0, 0.707});
+        probe.getFilter().cacheDynPara();
+        probe.getFilter().updateGainLinear(gains[0]);
+        probe.setControlInterval(control_interval);
+
+        auto output = input;
+        auto side = gains;
+        for (size_t start = 0; start < output.size(); start += kBlockSize) {
+            const auto num_samples = std::min(kBlockSize, output.size() - start);
+            double* main_pointer = output.data() + start;
+            double* side_pointer = side.data() + start;
+            probe.run({&main_pointer, 1}, {&side_pointer, 1}, num_samples);
+        }
+        return output;
+    }
+}
+
+int main() {
+    constexpr size_t kNumSamples = 48000;
+    // a held dynamic gain designs the same coefficients at every control point, so both paths must agree
+    // up to the rounding of double arithmetic
+    constexpr double kMaxHeldError = 1e-12;
+    // a moving dynamic gain makes the control-rate path run on interpolated coefficients, the bounds are
+    // relative to the peak of the per-sample output and sit about 1.5x above the measured errors
+    constexpr std::array<std::pair<size_t, double>, 4> kMaxSweepErrors{
+        {{4, 1.25e-5}, {16, 3.25e-5}, {32, 5e-5}, {64, 6e-5}}
+    };
+
+    std::mt19937 generator{42};
+    std::uniform_real_distribution<double> distribution{-0.5, 0.5};
+    std::vector<double> input(kNumSamples), gains(kNumSamples), held_gains(kNumSamples, 1.5);
+    for (size_t i = 0; i < kNumSamples; ++i) {
+        input[i] = distribution(generator);
+        // a dynamic gain sweeping between 0 dB and +12 dB at 4 Hz, like a fast follower
+        const auto phase = 2.0 * std::numbers::pi * 4.0 * static_cast<double>(i) / 48000.0;
+        gains[i] = 1.0 + 0.5 * (1.0 + std::sin(phase));
+    }
+
+    const auto held_reference = runProbe(1, input, held_gains);
+    const auto reference = runProbe(1, input, gains);
+    const auto held_peak = std::ranges::max(held_reference, {}, [](const double x) { return std::abs(x); });
+    const auto peak = std::ranges::max(reference, {}, [](const double x) { return std::abs(x); });
+    for (const auto& [control_interval, max_sweep_error] : kMaxSweepErrors) {
+        const auto held_output = runProbe(control_interval, input, held_gains);
+        const auto output = runProbe(control_interval, input, gains);
+        double held_error = 0.0, sweep_error = 0.0;
+        bool is_finite = true;
+        for (size_t i = 0; i < kNumSamples; ++i) {
+            is_finite = is_finite && std::isfinite(output[i]) && std::isfinite(held_output[i]);
+            held_error = std::max(held_error, std::abs(held_output[i] - held_reference[i]));
+            sweep_error = std::max(sweep_error, std::abs(output[i] - reference[i]));
+        }
+        held_error /= std::abs(held_peak);
+        sweep_error /= std::abs(peak);
+        std::printf("control interval %zu: held relative error %.3e, sweep relative error %.3e\n",
+                    control_interval, held_error, sweep_error);
+        ZL_CHECK(is_finite);
+        ZL_CHECK(held_error <= kMaxHeldError);
+        ZL_CHECK(sweep_error <= max_sweep_error);
+    }
+    return zltest::finish();
+}
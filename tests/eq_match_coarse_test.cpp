@@ -0,0 +1,90 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "test_helper.hpp"
+#include "chore/eq_match/eq_match_optimizer.hpp"
+
+namespace {
+    using zldsp::filter::FilterType;
+    using zldsp::filter::FilterParameters;
+
+    constexpr double kSampleRate = 48000.0;
+    // the grid size of MatchFFTPanel
+    constexpr size_t kNumPoints = 128;
+    constexpr size_t kNumBand = 16;
+
+    std::vector<float> getFreqs() {
+        std::vector<float> freqs(kNumPoints);
+        for (size_t i = 0; i < kNumPoints; ++i) {
+            freqs[i] = static_cast<float>(20.0 * std::pow(1000.0, static_cast<double>(i) / (kNumPoints - 1)));
+        }
+        return freqs;
+    }
+
+    /**
+     * the reference targets: smooth tonal differences, narrow resonances, a tilt and a mixture
+     */
+    std::vector<std::vector<float>> getReferenceBank(const std::vector<float>& freqs) {
+        std::vector<std::vector<float>> bank;
+        const auto add_target = [&](auto&& db_of_octave) {
+            auto& target = bank.emplace_back(freqs.size());
+            for (size_t i = 0; i < freqs.size(); ++i) {
+                target[i] = static_cast<float>(db_of_octave(std::log2(static_cast<double>(freqs[i]) / 1000.0)));
+            }
+        };
+        add_target([](const double x) { return 4.0 * std::tanh(-1.5 * (x + 2.5)) - 3.0 * std::tanh(x - 2.5); });
+        add_target([](const double x) { return 6.0 * std::exp(-x * x * 2.0) - 4.0 * std::exp(-(x + 3.0) * (x + 3.0) * 8.0); });
+        add_target([](const double x) { return -1.5 * x; });
+        add_target([](const double x) { return 3.0 * std::sin(1.7 * x) + 1.0; });
+        add_target([](const double x) {
+            return 5.0 * std::exp(-(x - 1.8) * (x - 1.8) * 20.0) - 7.0 * std::exp(-(x + 1.2) * (x + 1.2) * 30.0)
+                   + 2.0 * std::tanh(2.0 * (x - 3.0));
+        });
+        add_target([](const double x) { return 2.0 * std::cos(3.0 * x) * std::exp(-.1 * x * x) - .8 * x; });
+        return bank;
+    }
+}
+
+int main() {
+    const auto freqs = getFreqs();
+    const auto bank = getReferenceBank(freqs);
+    const auto should_return = []() { return false; };
+    std::printf("%7s %10s %10s %10s %10s\n", "target", "full mse", "coarse mse", "full ms", "coarse ms");
+    double full_total_ms{0.0}, coarse_total_ms{0.0};
+    for (size_t k = 0; k < bank.size(); ++k) {
+        std::array<double, 2> mses{}, times{};
+        for (const auto use_coarse_grid : {false, true}) {
+            auto freqs_copy = freqs;
+            auto target_copy = bank[k];
+            double mse{0.0};
+            std::vector<FilterParameters> paras;
+            const auto start = std::chrono::steady_clock::now();
+            zlchore::eq_match::EqMatchOptimizer optimizer{kSampleRate, freqs_copy, target_copy};
+            optimizer.setUseCoarseGrid(use_coarse_grid);
+            optimizer.setOnProgress([&](std::span<const FilterParameters>, const double c_mse) { mse = c_mse; });
+            optimizer.fit(paras, kNumBand, should_return);
+            times[use_coarse_grid] = std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now() - start).count();
+            mses[use_coarse_grid] = mse;
+        }
+        std::printf("%7zu %10.3f %10.3f %10.1f %10.1f\n", k, mses[0], mses[1], times[0], times[1]);
+        full_total_ms += times[0];
+        coarse_total_ms += times[1];
+        // only the global search runs on the decimated grid, the final local refinement keeps the full accuracy
+        ZL_CHECK(mses[1] <= 1.5 * mses[0] + .05);
+    }
+    std::printf("total: full %.1f ms, coarse %.1f ms\n", full_total_ms, coarse_total_ms);
+    return zltest::finish();
+}
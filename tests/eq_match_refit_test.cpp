@@ -0,0 +1,131 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "test_helper.hpp"
+#include "chore/eq_match/eq_match_optimizer.hpp"
+
+namespace {
+    using zldsp::filter::FilterType;
+    using zldsp::filter::FilterParameters;
+
+    constexpr double kSampleRate = 48000.0;
+    // the grid size of MatchFFTPanel
+    constexpr size_t kNumPoints = 128;
+    constexpr size_t kNumBand = 16;
+
+    std::vector<float> getFreqs() {
+        std::vector<float> freqs(kNumPoints);
+        for (size_t i = 0; i < kNumPoints; ++i) {
+            freqs[i] = static_cast<float>(20.0 * std::pow(1000.0, static_cast<double>(i) / (kNumPoints - 1)));
+        }
+        return freqs;
+    }
+
+    /**
+     * @return the summed response of the filters in dB
+     */
+    std::vector<float> getResponseDB(const std::vector<float>& freqs, const std::vector<FilterParameters>& paras) {
+        std::vector<float> ws(freqs.size()), dbs(freqs.size(), 0.f), mags(freqs.size());
+        for (size_t i = 0; i < freqs.size(); ++i) {
+            ws[i] = static_cast<float>(freqs[i] * (2.0 * std::numbers::pi / kSampleRate));
+        }
+        zldsp::filter::Ideal<float, 16> filter;
+        filter.prepare(kSampleRate);
+        for (const auto& para : paras) {
+            filter.forceUpdate(para);
+            filter.updateMagnitudeSquare(ws, mags);
+            for (size_t i = 0; i < freqs.size(); ++i) {
+                dbs[i] += 10.f * std::log10(mags[i]);
+            }
+        }
+        return dbs;
+    }
+
+    /**
+     * @return the MSE in the units of EqMatchOptimizer, 100 * mean((ln 10 / 10 * dB error)^2)
+     */
+    double getMSE(const std::vector<float>& freqs, const std::vector<float>& target,
+                  const std::vector<FilterParameters>& paras) {
+        const auto dbs = getResponseDB(freqs, paras);
+        double sum_sqr = 0.0;
+        for (size_t i = 0; i < freqs.size(); ++i) {
+            const auto err = (static_cast<double>(target[i]) - static_cast<double>(dbs[i])) * (std::log(10.0) * .1);
+            sum_sqr += err * err;
+        }
+        return 100. * sum_sqr / static_cast<double>(freqs.size());
+    }
+
+    /**
+     * a target which drifts slowly, jumps to an unrelated curve and drifts again
+     */
+    std::vector<std::vector<FilterParameters>> getTargetSequence() {
+        std::vector<std::vector<FilterParameters>> sequence;
+        for (size_t step = 0; step < 4; ++step) {
+            const auto drift = static_cast<double>(step);
+            sequence.push_back({
+                {FilterType::kLowShelf, 2, 120.0 * std::pow(1.03, drift), 4.0 + .3 * drift, .7},
+                {FilterType::kPeak, 2, 900.0 * std::pow(1.03, drift), -5.0 + .3 * drift, 1.5},
+                {FilterType::kPeak, 2, 3500.0 / std::pow(1.03, drift), 3.0, 2.0 + .1 * drift},
+                {FilterType::kHighShelf, 2, 9000.0, -6.0 - .3 * drift, .7},
+            });
+        }
+        for (size_t step = 0; step < 3; ++step) {
+            const auto drift = static_cast<double>(step);
+            sequence.push_back({
+                {FilterType::kHighShelf, 4, 2500.0 * std::pow(1.03, drift), 7.0 - .3 * drift, .6},
+                {FilterType::kPeak, 2, 60.0, -8.0 + .3 * drift, 1.0},
+                {FilterType::kPeak, 2, 450.0 * std::pow(1.03, drift), 5.0, 3.0},
+                {FilterType::kPeak, 2, 15000.0, -4.0, 1.2 + .1 * drift},
+                {FilterType::kLowShelf, 2, 250.0, 2.0 + .3 * drift, .7},
+            });
+        }
+        return sequence;
+    }
+}
+
+int main() {
+    const auto freqs = getFreqs();
+    const auto sequence = getTargetSequence();
+    const auto should_return = []() { return false; };
+    std::vector<FilterParameters> warm_paras;
+    std::printf("%5s %10s %10s %10s %10s %10s\n", "step", "target", "cold mse", "warm mse", "cold ms", "warm ms");
+    for (size_t step = 0; step < sequence.size(); ++step) {
+        const auto target = getResponseDB(freqs, sequence[step]);
+        auto freqs_copy = freqs;
+        auto target_copy = target;
+
+        std::vector<FilterParameters> cold_paras;
+        const auto cold_start = std::chrono::steady_clock::now();
+        zlchore::eq_match::EqMatchOptimizer cold_optimizer{kSampleRate, freqs_copy, target_copy};
+        cold_optimizer.fit(cold_paras, kNumBand, should_return);
+        const auto cold_ms = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - cold_start).count();
+
+        const auto previous_paras = warm_paras;
+        const auto warm_start = std::chrono::steady_clock::now();
+        zlchore::eq_match::EqMatchOptimizer warm_optimizer{kSampleRate, freqs_copy, target_copy};
+        warm_optimizer.refit(warm_paras, previous_paras, kNumBand, should_return);
+        const auto warm_ms = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - warm_start).count();
+
+        const auto target_mse = getMSE(freqs, target, {});
+        const auto cold_mse = getMSE(freqs, target, cold_paras);
+        const auto warm_mse = getMSE(freqs, target, warm_paras);
+        std::printf("%5zu %10.3f %10.3f %10.3f %10.1f %10.1f\n", step, target_mse, cold_mse, warm_mse,
+                    cold_ms, warm_ms);
+        // the warm start must not get stuck far above the cold fit, including right after the jump
+        ZL_CHECK(warm_mse <= 2.0 * cold_mse + .05);
+    }
+    return zltest::finish();
+}
@@ -0,0 +1,144 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+#include <cstdio>
+#include <limits>
+#include <vector>
+
+#include "test_helper.hpp"
+#include "panel/helper/frame_governor.hpp"
+
+namespace {
+    using zlpanel::FrameGovernor;
+
+    constexpr double kBudget = 0.25;
+    constexpr double kFrameRate = 60.0;
+    // the governor evaluates the usage every half second
+    constexpr size_t kFramesPerWindow = 30;
+
+    /**
+     * drive the governor at 60 frames per second with injected costs instead of measured ones
+     */
+    class Driver {
+    public:
+        explicit Driver(FrameGovernor& governor) : governor_(governor) {
+            governor_.update(0.0);
+        }
+
+        /**
+         * run one evaluation window in which the workers use the given fraction of one core
+         * @return the levels after every frame of the window
+         */
+        std::vector<int> runWindow(const double usage) {
+            std::vector<int> levels;
+            for (size_t i = 0; i < kFramesPerWindow; ++i) {
+                governor_.addCost(usage / kFrameRate);
+                frame_ += 1;
+                governor_.update(static_cast<double>(frame_) / kFrameRate);
+                levels.emplace_back(governor_.getLevel());
+            }
+            return levels;
+        }
+
+        /**
+         * @return the level at the end of the window
+         */
+        int runWindowLevel(const double usage) {
+            return runWindow(usage).back();
+        }
+
+    private:
+        FrameGovernor& governor_;
+        size_t frame_{0};
+    };
+
+    void testOverload() {
+        FrameGovernor governor{kBudget};
+        Driver driver{governor};
+        // within the budget nothing changes
+        for (size_t w = 0; w < 8; ++w) {
+            ZL_CHECK(driver.runWindowLevel(0.2) == FrameGovernor::kFull);
+        }
+        // an overload raises the level by one per window, never within a window, and saturates
+        for (int expected = FrameGovernor::kFull + 1; expected <= FrameGovernor::kMaxLevel; ++expected) {
+            const auto levels = driver.runWindow(0.6);
+            for (size_t i = 0; i + 1 < levels.size(); ++i) {
+                ZL_CHECK(levels[i] == expected - 1);
+            }
+            ZL_CHECK(levels.back() == expected);
+        }
+        for (size_t w = 0; w < 4; ++w) {
+            ZL_CHECK(driver.runWindowLevel(2.0) == FrameGovernor::kMaxLevel);
+        }
+    }
+
+    void testHysteresis() {
+        FrameGovernor governor{kBudget};
+        Driver driver{governor};
+        driver.runWindow(0.6);
+        driver.runWindow(0.6);
+        ZL_CHECK(governor.getLevel() == FrameGovernor::kHalfRate);
+        // between half of the budget and the budget the level holds
+        for (size_t w = 0; w < 16; ++w) {
+            ZL_CHECK(driver.runWindowLevel(0.2) == FrameGovernor::kHalfRate);
+        }
+        // single windows of headroom interrupted by the hold band never restore
+        for (size_t w = 0; w < 16; ++w) {
+            ZL_CHECK(driver.runWindowLevel(w % 2 == 0 ? 0.05 : 0.2) == FrameGovernor::kHalfRate);
+        }
+        // a single overloaded window between windows of headroom also resets the count
+        ZL_CHECK(driver.runWindowLevel(0.05) == FrameGovernor::kHalfRate);
+        ZL_CHECK(driver.runWindowLevel(0.3) == FrameGovernor::kReducedPoints);
+        ZL_CHECK(driver.runWindowLevel(0.05) == FrameGovernor::kReducedPoints);
+    }
+
+    void testRecovery() {
+        FrameGovernor governor{kBudget};
+        Driver driver{governor};
+        for (size_t w = 0; w < 6; ++w) {
+            driver.runWindow(1.0);
+        }
+        ZL_CHECK(governor.getLevel() == FrameGovernor::kMaxLevel);
+        // with headroom the level steps down once per two windows until full quality
+        for (int expected = FrameGovernor::kMaxLevel - 1; expected >= FrameGovernor::kFull; --expected) {
+            ZL_CHECK(driver.runWindowLevel(0.05) == expected + 1);
+            ZL_CHECK(driver.runWindowLevel(0.05) == expected);
+        }
+        for (size_t w = 0; w < 4; ++w) {
+            ZL_CHECK(driver.runWindowLevel(0.0) == FrameGovernor::kFull);
+        }
+    }
+
+    void testTimeStamps() {
+        FrameGovernor governor{kBudget};
+        ZL_CHECK(!governor.update(std::numeric_limits<double>::quiet_NaN()));
+        ZL_CHECK(!governor.update(10.0));
+        // a cost reported before the clock jumps back is dropped with the restarted window
+        governor.addCost(5.0);
+        ZL_CHECK(!governor.update(1.0));
+        ZL_CHECK(!governor.update(1.6));
+        ZL_CHECK(governor.getLevel() == FrameGovernor::kFull);
+        // a window longer than kWindowSeconds divides the cost by its real length
+        governor.addCost(0.2);
+        ZL_CHECK(!governor.update(2.6));
+        ZL_CHECK(governor.getLevel() == FrameGovernor::kFull);
+        governor.addCost(0.3);
+        ZL_CHECK(governor.update(3.6));
+        ZL_CHECK(governor.getLevel() == FrameGovernor::kSkipLargestFFT);
+    }
+}
+
+int main() {
+    testOverload();
+    testHysteresis();
+    testRecovery();
+    testTimeStamps();
+    std::printf("frame governor: overload, hysteresis, recovery and time stamps checked\n");
+    return zltest::finish();
+}
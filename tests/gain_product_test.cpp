@@ -0,0 +1,139 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "test_helper.hpp"
+#include "dsp/gain/gain.hpp"
+
+namespace {
+    constexpr double kSampleRate = 48000.0;
+    // a short ramp, so that most ramps end inside a block
+    constexpr double kRampLength = 0.005;
+
+    /**
+     * a change of the targets of the static gain compensation and the output gain, then the block sizes to process
+     */
+    struct Step {
+        double sgc_target, output_target;
+        std::vector<size_t> block_sizes;
+    };
+
+    const std::vector<Step> kSteps{
+        // neither is smoothing
+        {1.0, 1.0, {64}},
+        // only the static gain compensation ramps, the ramp ends in the second block
+        {0.5, 1.0, {100, 333, 64}},
+        // only the output gain ramps, with odd block sizes to hit the scalar tail
+        {0.5, 2.0, {1, 7, 13, 511, 3}},
+        // both ramp in opposite directions with different lengths, one ends before the other
+        {1.5, 0.25, {37, 129, 256, 1024}},
+        // a new target while the previous ramps are still running
+        {0.75, 1.0, {50}},
+        {0.1, 3.0, {200, 2048}},
+    };
+
+    /**
+     * @return the largest relative difference between the fused and the sequential gains over all steps
+     */
+    template <typename FloatType>
+    double compareFusedAndSequential() {
+        zldsp::gain::Gain<FloatType> sgc_seq, output_seq, sgc_fused, output_fused;
+        for (auto* gain : {&sgc_seq, &output_seq, &sgc_fused, &output_fused}) {
+            gain->prepare(kSampleRate, 0, kRampLength);
+            gain->reset();
+        }
+        std::mt19937 generator{42};
+        std::uniform_real_distribution<FloatType> distribution{FloatType(-1), FloatType(1)};
+
+        double max_error = 0.0;
+        for (const auto& step : kSteps) {
+            sgc_seq.setGainLinear(static_cast<FloatType>(step.sgc_target));
+            sgc_fused.setGainLinear(static_cast<FloatType>(step.sgc_target));
+            output_seq.setGainLinear(static_cast<FloatType>(step.output_target));
+            output_fused.setGainLinear(static_cast<FloatType>(step.output_target));
+            for (const auto block_size : step.block_sizes) {
+                std::array<std::vector<FloatType>, 2> seq, fused;
+                for (size_t chan = 0; chan < 2; ++chan) {
+                    seq[chan].resize(block_size);
+                    std::generate(seq[chan].begin(), seq[chan].end(), [&]() { return distribution(generator); });
+                    fused[chan] = seq[chan];
+                }
+                std::array<FloatType*, 2> seq_pointers{seq[0].data(), seq[1].data()};
+                std::array<FloatType*, 2> fused_pointers{fused[0].data(), fused[1].data()};
+
+                sgc_seq.process(std::span<FloatType*>(seq_pointers), block_size);
+                output_seq.process(std::span<FloatType*>(seq_pointers), block_size);
+                zldsp::gain::processProduct(std::array{&sgc_fused, &output_fused},
+                                            std::span<FloatType*>(fused_pointers), block_size);
+
+                for (size_t chan = 0; chan < 2; ++chan) {
+                    for (size_t i = 0; i < block_size; ++i) {
+                        const auto error = std::abs(static_cast<double>(fused[chan][i] - seq[chan][i]));
+                        const auto scale = std::max(std::abs(static_cast<double>(seq[chan][i])), 1e-3);
+                        max_error = std::max(max_error, error / scale);
+                    }
+                }
+                // the smoothers advance by the same amount, so the next block starts from the same gains
+                ZL_CHECK(sgc_fused.isSmoothing() == sgc_seq.isSmoothing());
+                ZL_CHECK(output_fused.isSmoothing() == output_seq.isSmoothing());
+                ZL_CHECK(sgc_fused.getCurrentGainLinear() == sgc_seq.getCurrentGainLinear());
+                ZL_CHECK(output_fused.getCurrentGainLinear() == output_seq.getCurrentGainLinear());
+            }
+        }
+        // every ramp has reached its target at the end
+        ZL_CHECK(!sgc_seq.isSmoothing() && !output_seq.isSmoothing());
+        return max_error;
+    }
+
+    /**
+     * @return the largest difference between the ramp of Gain and the per-sample getNext() loop it replaces
+     */
+    double compareRampWithGetNext() {
+        zldsp::gain::Gain<double> gain;
+        zldsp::chore::SmoothedValue<double, zldsp::chore::SmoothedTypes::kFixLin> reference{1.0};
+        gain.prepare(kSampleRate, 0, kRampLength);
+        gain.reset();
+        reference.prepare(kSampleRate, kRampLength);
+
+        double max_error = 0.0;
+        for (const auto& step : kSteps) {
+            gain.setGainLinear(step.sgc_target);
+            reference.setTarget(step.sgc_target);
+            for (const auto block_size : step.block_sizes) {
+                std::vector<double> ones(block_size, 1.0);
+                double* pointer = ones.data();
+                gain.process(std::span<double*>(&pointer, 1), block_size);
+                for (size_t i = 0; i < block_size; ++i) {
+                    max_error = std::max(max_error, std::abs(ones[i] - reference.getNext()));
+                }
+            }
+        }
+        return max_error;
+    }
+}
+
+int main() {
+    const auto float_error = compareFusedAndSequential<float>();
+    const auto double_error = compareFusedAndSequential<double>();
+    const auto ramp_error = compareRampWithGetNext();
+    std::printf("fused vs sequential: float %.3e, double %.3e\n", float_error, double_error);
+    std::printf("closed-form ramp vs getNext(): %.3e\n", ramp_error);
+    // the fused pass rounds once instead of twice
+    ZL_CHECK(float_error <= 1e-6);
+    ZL_CHECK(double_error <= 1e-14);
+    ZL_CHECK(ramp_error <= 1e-9);
+    return zltest::finish();
+}
@@ -0,0 +1,100 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+#include <juce_graphics/juce_graphics.h>
+#include <array>
+#include <cmath>
+#include <cstdio>
+
+#include "test_helper.hpp"
+#include "panel/helper/image_layer.hpp"
+
+namespace {
+    // the size of the analyzer of a large editor on a 2x display
+    constexpr float kWidth = 1200.f;
+    constexpr float kHeight = 600.f;
+    constexpr float kScale = 2.f;
+    constexpr size_t kNumSources = 3;
+    constexpr size_t kNumPoints = 400;
+
+    std::array<juce::Path, kNumSources> getSpectrumPaths() {
+        std::array<juce::Path, kNumSources> paths;
+        for (size_t i = 0; i < kNumSources; ++i) {
+            auto& path{paths[i]};
+            path.startNewSubPath(-.1f, kHeight * 1.5f);
+            for (size_t j = 0; j < kNumPoints; ++j) {
+                const auto x = kWidth * static_cast<float>(j) / static_cast<float>(kNumPoints - 1);
+                const auto y = kHeight * (.45f + .1f * static_cast<float>(i)
+                                          + .2f * std::sin(.05f * static_cast<float>(j * (i + 1)))
+                                          + .05f * std::sin(.9f * static_cast<float>(j)));
+                path.lineTo(x, y);
+            }
+            path.lineTo(kWidth + .1f, kHeight * 1.5f);
+            path.closeSubPath();
+        }
+        return paths;
+    }
+
+    /**
+     * the spectrum drawing of FFTPanel::renderLayer
+     */
+    void paintSpectrum(juce::Graphics& g, const std::array<juce::Path, kNumSources>& paths) {
+        g.setColour(juce::Colours::grey.withAlpha(.25f));
+        g.fillPath(paths[0]);
+        g.setColour(juce::Colours::orange);
+        g.strokePath(paths[1], {2.4f, juce::PathStrokeType::curved, juce::PathStrokeType::rounded});
+        g.setColour(juce::Colours::orange.withAlpha(.25f));
+        g.fillPath(paths[1]);
+        g.setColour(juce::Colours::skyblue.withAlpha(.25f));
+        g.fillPath(paths[2]);
+    }
+}
+
+/**
+ * the message thread cost of one analyzer frame, with the paths drawn in paint() as before the image layer
+ * and with the cached layer blitted, the worker cost of rasterising the layer is reported separately
+ * the target is a software image at the physical size, so the numbers exclude the presentation by the OS
+ */
+int main() {
+    const auto paths = getSpectrumPaths();
+    juce::Image target(juce::Image::ARGB, static_cast<int>(kWidth * kScale), static_cast<int>(kHeight * kScale),
+                       true, juce::SoftwareImageType());
+
+    const auto direct_ns = zltest::timeNanoseconds([&]() {
+        juce::Graphics g(target);
+        g.addTransform(juce::AffineTransform::scale(kScale));
+        paintSpectrum(g, paths);
+    }, 64);
+
+    zlpanel::ImageLayer layer;
+    layer.setScale(kScale);
+    const auto render_ns = zltest::timeNanoseconds([&]() {
+        layer.render(kWidth, kHeight, [&](juce::Graphics& g) {
+            paintSpectrum(g, paths);
+        });
+    }, 64);
+    const auto blit_ns = zltest::timeNanoseconds([&]() {
+        juce::Graphics g(target);
+        g.addTransform(juce::AffineTransform::scale(kScale));
+        layer.draw(g, kWidth, kHeight);
+    }, 64);
+    // while resizing, the stale frame is stretched to the new size
+    const auto stretch_ns = zltest::timeNanoseconds([&]() {
+        juce::Graphics g(target);
+        g.addTransform(juce::AffineTransform::scale(kScale));
+        layer.draw(g, kWidth * .9f, kHeight * .9f);
+    }, 64);
+
+    std::printf("%.0f x %.0f at scale %.1f, %zu sources, %zu points\n", kWidth, kHeight, kScale, kNumSources,
+                kNumPoints);
+    std::printf("message thread: paths in paint %8.1f us, layer blit %8.1f us, stretched blit %8.1f us\n",
+                direct_ns * 1e-3, blit_ns * 1e-3, stretch_ns * 1e-3);
+    std::printf("worker thread:  layer render   %8.1f us\n", render_ns * 1e-3);
+    return 0;
+}
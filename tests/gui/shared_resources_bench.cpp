@@ -0,0 +1,78 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+#include <juce_gui_basics/juce_gui_basics.h>
+#include <cstdio>
+#include <vector>
+
+#include "test_helper.hpp"
+#include "gui/shared_resources.hpp"
+
+namespace {
+    /**
+     * the font and the icons which every editor loads, read from the asset folder instead of BinaryData
+     */
+    struct Assets {
+        juce::MemoryBlock font;
+        std::vector<juce::MemoryBlock> icons;
+    };
+
+    Assets loadAssets() {
+        const juce::File assets_dir{ZL_ASSETS_DIR};
+        Assets assets;
+        assets_dir.getChildFile("font/Inter-Subset-Medium.ttf").loadFileAsData(assets.font);
+        for (const auto& icon : assets_dir.getChildFile("icons").findChildFiles(
+                 juce::File::findFiles, true, "*.svg")) {
+            icon.loadFileAsData(assets.icons.emplace_back());
+        }
+        return assets;
+    }
+}
+
+/**
+ * the editor-open cost of the resources held by SharedResources, for N editors opened one after another
+ * own: every editor creates the typeface and parses every icon, as before SharedResources
+ * shared: the first editor creates them and the others reuse them
+ */
+int main() {
+    const juce::ScopedJuceInitialiser_GUI juce_initialiser;
+    const auto assets = loadAssets();
+    std::printf("%zu KiB font, %zu icons\n", assets.font.getSize() / 1024, assets.icons.size());
+    std::printf("%10s %12s %12s %12s %12s\n", "editors", "own ms", "shared ms", "own objs", "shared objs");
+    for (const size_t num_editors : {1, 4, 16}) {
+        std::vector<juce::Typeface::Ptr> own_typefaces;
+        std::vector<std::unique_ptr<juce::Drawable>> own_drawables;
+        const auto own_ns = zltest::timeNanoseconds([&]() {
+            own_typefaces.clear();
+            own_drawables.clear();
+            for (size_t i = 0; i < num_editors; ++i) {
+                own_typefaces.push_back(juce::Typeface::createSystemTypefaceFor(
+                    assets.font.getData(), assets.font.getSize()));
+                for (const auto& icon : assets.icons) {
+                    own_drawables.push_back(juce::Drawable::createFromImageData(icon.getData(), icon.getSize()));
+                }
+            }
+        }, 4);
+        size_t num_shared_objects{0};
+        const auto shared_ns = zltest::timeNanoseconds([&]() {
+            zlgui::SharedResources resources;
+            std::vector<juce::Drawable*> drawables;
+            for (size_t i = 0; i < num_editors; ++i) {
+                juce::ignoreUnused(resources.getTypeface(assets.font.getData(), assets.font.getSize()));
+                for (const auto& icon : assets.icons) {
+                    drawables.push_back(resources.getDrawable(icon.getData(), icon.getSize()));
+                }
+            }
+            num_shared_objects = 1 + assets.icons.size();
+        }, 4);
+        std::printf("%10zu %12.2f %12.2f %12zu %12zu\n", num_editors, own_ns * 1e-6, shared_ns * 1e-6,
+                    own_typefaces.size() + own_drawables.size(), num_shared_objects);
+    }
+    return 0;
+}
@@ -0,0 +1,155 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <numbers>
+#include <vector>
+
+#include "test_helper.hpp"
+#include "dsp/filter/ideal_filter/ideal_batch.hpp"
+#include "dsp/filter/fir_filter/mixed_correction/mixed_calculator.hpp"
+
+namespace {
+    constexpr double kSampleRate = 48000.0;
+    constexpr size_t kFilterSize = 16;
+
+    using zldsp::filter::FilterType;
+    using Filter = zldsp::filter::Ideal<float, kFilterSize>;
+
+    volatile float sink = 0.f;
+
+    std::vector<float> getLogGrid(const size_t num_points) {
+        std::vector<float> ws(num_points);
+        for (size_t i = 0; i < num_points; ++i) {
+            const auto freq = 10.0 * std::pow(2200.0, static_cast<double>(i) / static_cast<double>(num_points - 1));
+            ws[i] = static_cast<float>(freq * (2.0 * std::numbers::pi / kSampleRate));
+        }
+        return ws;
+    }
+
+    zldsp::filter::FilterParameters getBandParameters(const size_t band) {
+        constexpr std::array kTypes{FilterType::kPeak, FilterType::kLowShelf, FilterType::kHighShelf};
+        return {
+            kTypes[band % kTypes.size()], static_cast<size_t>(2 + 2 * (band % 3)),
+            40.0 * std::pow(1.3, static_cast<double>(band)), static_cast<double>(band % 7) - 3.0, 0.707
+        };
+    }
+
+    /**
+     * ResponsePanel: the base, target and dynamic magnitudes of 24 bands on 400 points
+     */
+    void benchResponsePanel() {
+        constexpr size_t kNumBands = 24;
+        constexpr size_t kNumJobs = 3 * kNumBands;
+        auto ws = getLogGrid(400);
+        std::array<Filter, kNumBands> filters;
+        std::vector<std::vector<float>> mags(kNumJobs, std::vector<float>(ws.size()));
+        static zldsp::filter::IdealBatch<float, kNumJobs * kFilterSize, kNumJobs> batch;
+        batch.prepare(ws);
+        for (size_t band = 0; band < kNumBands; ++band) {
+            filters[band].prepare(kSampleRate);
+            filters[band].forceUpdate(getBandParameters(band));
+        }
+        const auto single_ns = zltest::timeNanoseconds([&]() {
+            for (size_t j = 0; j < kNumJobs; ++j) {
+                filters[j % kNumBands].updateMagnitudeSquare(ws, mags[j]);
+            }
+            sink = sink + mags[0][0];
+        }, 256);
+        const auto batch_ns = zltest::timeNanoseconds([&]() {
+            batch.clear();
+            for (size_t j = 0; j < kNumJobs; ++j) {
+                batch.addMagnitudeSquare(filters[j % kNumBands], mags[j]);
+            }
+            batch.process();
+            sink = sink + mags[0][0];
+        }, 256);
+        std::printf("%-40s %10.2f %10.2f %8.2f\n", "response panel (72 curves, 400 points)",
+                    single_ns * 1e-3, batch_ns * 1e-3, single_ns / batch_ns);
+    }
+
+    /**
+     * EQMatchOptimizer: the value and the six central differences of a peak on 251 points
+     */
+    void benchMatchOptimizer() {
+        constexpr size_t kNumEvaluations = 7;
+        auto ws = getLogGrid(251);
+        Filter filter;
+        filter.prepare(kSampleRate);
+        filter.forceUpdate({FilterType::kPeak, 2, 1000.0, 3.0, 0.707});
+        std::vector<std::vector<float>> mags(kNumEvaluations, std::vector<float>(ws.size()));
+        zldsp::filter::IdealBatch<float, 6 * kNumEvaluations, kNumEvaluations> batch;
+        batch.prepare(ws);
+        const auto single_ns = zltest::timeNanoseconds([&]() {
+            for (size_t k = 0; k < kNumEvaluations; ++k) {
+                filter.setGain(3.0 + 0.01 * static_cast<double>(k));
+                filter.updateCoeffs();
+                filter.updateMagnitudeSquare(ws, mags[k]);
+            }
+            sink = sink + mags[0][0];
+        }, 1024);
+        const auto batch_ns = zltest::timeNanoseconds([&]() {
+            batch.clear();
+            for (size_t k = 0; k < kNumEvaluations; ++k) {
+                filter.setGain(3.0 + 0.01 * static_cast<double>(k));
+                filter.updateCoeffs();
+                batch.addMagnitudeSquare(filter, mags[k]);
+            }
+            batch.process();
+            sink = sink + mags[0][0];
+        }, 1024);
+        std::printf("%-40s %10.2f %10.2f %8.2f\n", "match optimizer (7 evaluations, 251 points)",
+                    single_ns * 1e-3, batch_ns * 1e-3, single_ns / batch_ns);
+    }
+
+    /**
+     * CorrectionCalculator: the corrections of 8 bands on 2049 bins
+     * one band per call is how the bands were batched before, all bands in one call share the passes
+     */
+    void benchCorrectionCalculator() {
+        constexpr size_t kNumBands = 8;
+        constexpr size_t kNumBin = 2049;
+        std::array<zldsp::filter::TDF<float, kFilterSize>, kNumBands> tdfs;
+        std::array<Filter, kNumBands> ideals;
+        std::array<size_t, kNumBands> indices{};
+        std::array<bool, kNumBands> flags{};
+        for (size_t band = 0; band < kNumBands; ++band) {
+            tdfs[band].prepare(kSampleRate, 1, 0);
+            ideals[band].prepare(kSampleRate);
+            tdfs[band].forceUpdate(getBandParameters(band));
+            ideals[band].forceUpdate(getBandParameters(band));
+            indices[band] = band;
+            flags[band] = true;
+        }
+        static zldsp::filter::MixedCalculator<kNumBands, kFilterSize> calculator;
+        calculator.prepare(kNumBin);
+        const auto single_ns = zltest::timeNanoseconds([&]() {
+            for (size_t band = 0; band < kNumBands; ++band) {
+                calculator.update(tdfs, ideals, std::span{indices.data() + band, 1}, flags);
+            }
+            sink = sink + calculator.getCorrectionsReal()[0][1];
+        }, 64);
+        const auto batch_ns = zltest::timeNanoseconds([&]() {
+            calculator.update(tdfs, ideals, indices, flags);
+            sink = sink + calculator.getCorrectionsReal()[0][1];
+        }, 64);
+        std::printf("%-40s %10.2f %10.2f %8.2f\n", "correction calculator (8 bands, 2049 bins)",
+                    single_ns * 1e-3, batch_ns * 1e-3, single_ns / batch_ns);
+    }
+}
+
+int main() {
+    std::printf("%-40s %10s %10s %8s\n", "call site", "single us", "batch us", "ratio");
+    benchResponsePanel();
+    benchMatchOptimizer();
+    benchCorrectionCalculator();
+    return 0;
+}
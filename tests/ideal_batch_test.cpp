@@ -0,0 +1,192 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <numbers>
+#include <vector>
+
+#include "test_helper.hpp"
+#include "dsp/filter/ideal_filter/ideal_batch.hpp"
+#include "dsp/filter/fir_filter/zero_correction/zero_calculator.hpp"
+#include "dsp/filter/fir_filter/mixed_correction/mixed_calculator.hpp"
+
+namespace {
+    constexpr double kSampleRate = 48000.0;
+    constexpr size_t kFilterSize = 16;
+    // an odd grid size, so that the scalar tail is covered
+    constexpr size_t kNumPoints = 403;
+
+    using zldsp::filter::FilterType;
+    using Filter = zldsp::filter::Ideal<float, kFilterSize>;
+
+    constexpr std::array kFilterTypes{
+        FilterType::kPeak, FilterType::kLowShelf, FilterType::kLowPass, FilterType::kHighShelf,
+        FilterType::kHighPass, FilterType::kNotch, FilterType::kBandPass, FilterType::kTiltShelf,
+        FilterType::kFlatTilt, FilterType::kAllPass, FilterType::kFlatGain
+    };
+    constexpr std::array<size_t, 4> kOrders{1, 2, 4, 16};
+
+    /**
+     * the parameters of every filter type at several orders, frequencies and gains
+     */
+    std::vector<zldsp::filter::FilterParameters> getAllParameters() {
+        std::vector<zldsp::filter::FilterParameters> parameters;
+        for (const auto filter_type : kFilterTypes) {
+            for (const auto order : kOrders) {
+                for (const auto freq : {30.0, 1000.0, 15000.0}) {
+                    parameters.push_back({filter_type, order, freq, freq < 500.0 ? -12.0 : 9.0,
+                                          freq > 5000.0 ? 4.0 : 0.5});
+                }
+            }
+        }
+        return parameters;
+    }
+
+    /**
+     * @return the difference relative to the reference, small references are compared to 1e-6 of the peak
+     */
+    double getError(const std::vector<float>& output, const std::vector<float>& reference) {
+        float peak{0.f};
+        for (const auto x : reference) {
+            peak = std::max(peak, std::abs(x));
+        }
+        double max_error{0.0};
+        for (size_t i = 0; i < output.size(); ++i) {
+            const auto scale = std::max(std::abs(static_cast<double>(reference[i])), 1e-6 * peak);
+            max_error = std::max(max_error, std::abs(static_cast<double>(output[i] - reference[i])) / scale);
+        }
+        return max_error;
+    }
+
+    /**
+     * all filters are added to one batch, as the response panel does across its bands
+     * @return the largest errors of the magnitude square and the complex response
+     */
+    std::pair<double, double> compareWithIdeal(std::vector<float>& ws) {
+        const auto parameters = getAllParameters();
+        constexpr size_t kMaxJobs = 2 * kFilterTypes.size() * kOrders.size() * 3;
+        static zldsp::filter::IdealBatch<float, kMaxJobs * kFilterSize, kMaxJobs> batch;
+        batch.prepare(ws);
+        std::vector<Filter> filters(parameters.size());
+        std::vector<std::vector<float>> mags(parameters.size(), std::vector<float>(ws.size()));
+        std::vector<std::vector<float>> reals(parameters.size(), std::vector<float>(ws.size()));
+        std::vector<std::vector<float>> imags(parameters.size(), std::vector<float>(ws.size()));
+        for (size_t k = 0; k < parameters.size(); ++k) {
+            filters[k].prepare(kSampleRate);
+            filters[k].forceUpdate(parameters[k]);
+            batch.addMagnitudeSquare(filters[k], mags[k]);
+            batch.addResponse(filters[k].getActiveCoeffs(), reals[k], imags[k]);
+        }
+        batch.process();
+
+        double mag_error{0.0}, response_error{0.0};
+        std::vector<float> ref_mag(ws.size()), ref_real(ws.size()), ref_imag(ws.size());
+        for (size_t k = 0; k < parameters.size(); ++k) {
+            filters[k].updateMagnitudeSquare(ws, ref_mag);
+            const auto coeffs = filters[k].getActiveCoeffs();
+            std::ranges::fill(ref_real, 1.f);
+            std::ranges::fill(ref_imag, 0.f);
+            for (const auto& coeff : coeffs) {
+                zldsp::filter::IdealBase<float>::updateResponse<false>(coeff, ws, ref_real, ref_imag);
+            }
+            const auto k_mag_error = getError(mags[k], ref_mag);
+            // the real and imaginary parts are compared relative to the magnitude
+            double k_response_error{0.0};
+            for (size_t i = 0; i < ws.size(); ++i) {
+                const auto ref_abs_i = std::hypot(static_cast<double>(ref_real[i]), static_cast<double>(ref_imag[i]));
+                const auto diff = std::hypot(static_cast<double>(reals[k][i] - ref_real[i]),
+                                             static_cast<double>(imags[k][i] - ref_imag[i]));
+                k_response_error = std::max(k_response_error, diff / std::max(ref_abs_i, 1e-6));
+            }
+            if (k_mag_error > 1e-4 || k_response_error > 1e-4) {
+                std::printf("type %d, order %zu, freq %.0f: magnitude %.3e, response %.3e\n",
+                            static_cast<int>(parameters[k].filter_type), parameters[k].order, parameters[k].freq,
+                            k_mag_error, k_response_error);
+            }
+            mag_error = std::max(mag_error, k_mag_error);
+            response_error = std::max(response_error, k_response_error);
+        }
+        return {mag_error, response_error};
+    }
+
+    /**
+     * the corrections of all bands updated in one call must equal the corrections of the bands updated one by one
+     * 8 bands with up to 16 stages each take several passes of the batch
+     */
+    template <typename Calculator>
+    double compareCrossBandCorrections() {
+        constexpr size_t kNumBands = 8;
+        constexpr size_t kNumBin = 1025;
+        std::array<zldsp::filter::TDF<float, kFilterSize>, kNumBands> tdfs;
+        std::array<Filter, kNumBands> ideals;
+        const std::array<zldsp::filter::FilterParameters, kNumBands> parameters{{
+            {FilterType::kPeak, 2, 100.0, 6.0, 0.7},
+            {FilterType::kLowShelf, 4, 200.0, -6.0, 0.7},
+            {FilterType::kHighPass, 16, 40.0, 0.0, 0.7},
+            {FilterType::kNotch, 2, 3000.0, 0.0, 4.0},
+            {FilterType::kTiltShelf, 2, 1000.0, 3.0, 0.7},
+            {FilterType::kLowPass, 8, 12000.0, 0.0, 0.7},
+            {FilterType::kBandPass, 4, 500.0, 0.0, 1.0},
+            {FilterType::kHighShelf, 16, 8000.0, 9.0, 0.7},
+        }};
+        for (size_t band = 0; band < kNumBands; ++band) {
+            tdfs[band].prepare(kSampleRate, 1, 0);
+            ideals[band].prepare(kSampleRate);
+            tdfs[band].forceUpdate(parameters[band]);
+            ideals[band].forceUpdate(parameters[band]);
+        }
+        Calculator together, one_by_one;
+        together.prepare(kNumBin);
+        one_by_one.prepare(kNumBin);
+
+        std::array<size_t, kNumBands> indices{};
+        std::array<bool, kNumBands> flags{};
+        for (size_t band = 0; band < kNumBands; ++band) {
+            indices[band] = band;
+            flags[band] = true;
+        }
+        together.update(tdfs, ideals, indices, flags);
+        for (size_t band = 0; band < kNumBands; ++band) {
+            one_by_one.update(tdfs, ideals, std::span{indices.data() + band, 1}, flags);
+        }
+        double max_error{0.0};
+        for (size_t band = 0; band < kNumBands; ++band) {
+            for (size_t i = 0; i < kNumBin; ++i) {
+                max_error = std::max(max_error, static_cast<double>(std::abs(
+                    together.getCorrectionsReal()[band][i] - one_by_one.getCorrectionsReal()[band][i])));
+                max_error = std::max(max_error, static_cast<double>(std::abs(
+                    together.getCorrectionsImag()[band][i] - one_by_one.getCorrectionsImag()[band][i])));
+            }
+        }
+        return max_error;
+    }
+}
+
+int main() {
+    std::vector<float> ws(kNumPoints);
+    for (size_t i = 0; i < kNumPoints; ++i) {
+        const auto freq = 10.0 * std::pow(2200.0, static_cast<double>(i) / static_cast<double>(kNumPoints - 1));
+        ws[i] = static_cast<float>(freq * (2.0 * std::numbers::pi / kSampleRate));
+    }
+    const auto [mag_error, response_error] = compareWithIdeal(ws);
+    std::printf("batch vs Ideal: magnitude square %.3e, response %.3e\n", mag_error, response_error);
+    ZL_CHECK(mag_error <= 1e-4);
+    ZL_CHECK(response_error <= 1e-4);
+
+    constexpr size_t kBandNum = 8;
+    const auto zero_error = compareCrossBandCorrections<zldsp::filter::ZeroCalculator<kBandNum, kFilterSize>>();
+    const auto mixed_error = compareCrossBandCorrections<zldsp::filter::MixedCalculator<kBandNum, kFilterSize>>();
+    std::printf("cross-band vs per-band corrections: zero %.3e, mixed %.3e\n", zero_error, mixed_error);
+    ZL_CHECK(zero_error == 0.0);
+    ZL_CHECK(mixed_error == 0.0);
+    return zltest::finish();
+}
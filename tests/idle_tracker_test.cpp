@@ -0,0 +1,156 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "test_helper.hpp"
+#include "dsp/analyzer/fft_analyzer/spectrum_decayer.hpp"
+#include "panel/helper/idle_tracker.hpp"
+
+namespace {
+    using zlpanel::IdleTracker;
+
+    constexpr float kFrameRate = 60.f;
+    constexpr size_t kSamplesPerFrame = 800;
+    constexpr size_t kFIFOSize = 4096;
+    constexpr size_t kNumBins = 257;
+    // the display range of the analyzer, mapped onto 400 pixels
+    constexpr float kMinDB = -72.f;
+    constexpr float kHeight = 400.f;
+
+    /**
+     * a headless version of the FFTPanel frame loop
+     * the FFT is replaced by the level of the input, which is enough to drive the decay of the display
+     */
+    class HeadlessAnalyzer {
+    public:
+        HeadlessAnalyzer() : sample_fifo_(2, std::vector<float>(kFIFOSize, 0.f)),
+                             spectrum_(kNumBins), ys_(kNumBins), previous_ys_(kNumBins, 0.f) {
+            decayer_.prepareSpectrum(kNumBins);
+            decayer_.setDecaySpeed(kFrameRate, kMinDB, 0.15f);
+        }
+
+        /**
+         * push one frame of samples and run the frame loop
+         * @param amplitude the amplitude of the noise, zero for silence
+         * @param is_changed whether a display setting changed during the frame
+         */
+        void runFrame(const float amplitude, const bool is_changed) {
+            std::uniform_real_distribution<float> distribution{-1.f, 1.f};
+            float level{0.f};
+            for (size_t i = 0; i < kSamplesPerFrame; ++i) {
+                for (auto& samples : sample_fifo_) {
+                    samples[write_pos_] = amplitude * distribution(generator_);
+                    level = std::max(level, std::abs(samples[write_pos_]));
+                }
+                write_pos_ = (write_pos_ + 1) % kFIFOSize;
+            }
+            // the frame reads what was written since the last frame, wrapping around the end of the FIFO
+            const auto start = static_cast<int>((write_pos_ + kFIFOSize - kSamplesPerFrame) % kFIFOSize);
+            const auto size1 = std::min(static_cast<int>(kSamplesPerFrame), static_cast<int>(kFIFOSize) - start);
+            const zldsp::container::FIFORange range{
+                start, size1, 0, static_cast<int>(kSamplesPerFrame) - size1
+            };
+            const auto is_input_active = IdleTracker::hasSignal(range, sample_fifo_);
+            ZL_CHECK(is_input_active == (level > IdleTracker::kSilenceLevel));
+
+            if (!tracker_.shouldCompute(is_input_active, is_changed)) {
+                num_skipped_ += 1;
+                return;
+            }
+            num_computed_ += 1;
+            const auto db = 20.f * std::log10(std::max(level, 1e-12f));
+            std::ranges::fill(spectrum_, db);
+            decayer_.decay(std::span{spectrum_.data(), spectrum_.size()});
+            float max_change{0.f};
+            for (size_t i = 0; i < kNumBins; ++i) {
+                ys_[i] = spectrum_[i] * (kHeight / kMinDB);
+                max_change = std::max(max_change, std::abs(ys_[i] - previous_ys_[i]));
+            }
+            previous_ys_ = ys_;
+            tracker_.finishFrame(is_input_active, max_change);
+        }
+
+        /**
+         * @return the number of skipped frames and the number of computed frames since the last call
+         */
+        std::pair<size_t, size_t> takeCounts() {
+            const auto counts = std::make_pair(num_skipped_, num_computed_);
+            num_skipped_ = 0;
+            num_computed_ = 0;
+            return counts;
+        }
+
+    private:
+        std::mt19937 generator_{42};
+        std::vector<std::vector<float>> sample_fifo_;
+        size_t write_pos_{0};
+        zldsp::analyzer::SpectrumDecayer decayer_;
+        std::vector<float> spectrum_, ys_, previous_ys_;
+        IdleTracker tracker_;
+        size_t num_skipped_{0}, num_computed_{0};
+    };
+}
+
+int main() {
+    static_assert(kFIFOSize % kSamplesPerFrame != 0, "the frames should wrap around the FIFO");
+    HeadlessAnalyzer analyzer;
+    constexpr size_t kNumFrames = 120;
+
+    // active input at -20 dBFS, every frame is computed
+    for (size_t i = 0; i < kNumFrames; ++i) {
+        analyzer.runFrame(0.1f, false);
+    }
+    const auto [active_skipped, active_computed] = analyzer.takeCounts();
+    std::printf("active: %zu skipped, %zu computed\n", active_skipped, active_computed);
+    ZL_CHECK(active_skipped == 0 && active_computed == kNumFrames);
+
+    // silent input, the display decays, settles and then the frames are skipped
+    for (size_t i = 0; i < kNumFrames; ++i) {
+        analyzer.runFrame(0.f, false);
+    }
+    const auto [silent_skipped, silent_computed] = analyzer.takeCounts();
+    std::printf("silent: %zu skipped, %zu computed\n", silent_skipped, silent_computed);
+    ZL_CHECK(silent_computed + silent_skipped == kNumFrames);
+    ZL_CHECK(silent_computed >= static_cast<size_t>(IdleTracker::kSettledFrames));
+    // the decay continues below the visible range, so settling takes longer than the visible fade
+    ZL_CHECK(silent_skipped >= kNumFrames / 4);
+
+    // while settled, a setting change computes the frames until the display has settled again
+    analyzer.runFrame(0.f, true);
+    for (size_t i = 1; i < kNumFrames; ++i) {
+        analyzer.runFrame(0.f, false);
+    }
+    const auto [change_skipped, change_computed] = analyzer.takeCounts();
+    std::printf("silent after a setting change: %zu skipped, %zu computed\n", change_skipped, change_computed);
+    ZL_CHECK(change_computed == static_cast<size_t>(IdleTracker::kSettledFrames));
+
+    // input below -120 dBFS still counts as silence
+    for (size_t i = 0; i < kNumFrames; ++i) {
+        analyzer.runFrame(5e-7f, false);
+    }
+    const auto [quiet_skipped, quiet_computed] = analyzer.takeCounts();
+    std::printf("below -120 dBFS: %zu skipped, %zu computed\n", quiet_skipped, quiet_computed);
+    ZL_CHECK(quiet_computed == 0);
+
+    // the input returns, every frame is computed again
+    for (size_t i = 0; i < kNumFrames; ++i) {
+        analyzer.runFrame(0.1f, false);
+    }
+    const auto [resumed_skipped, resumed_computed] = analyzer.takeCounts();
+    std::printf("active again: %zu skipped, %zu computed\n", resumed_skipped, resumed_computed);
+    ZL_CHECK(resumed_skipped == 0 && resumed_computed == kNumFrames);
+    return zltest::finish();
+}
@@ -0,0 +1,141 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <numbers>
+#include <span>
+#include <vector>
+
+#include "test_helper.hpp"
+#include "dsp/filter/iir_filter/coeff/ivantsov_batch.hpp"
+
+namespace {
+    namespace batch = zldsp::filter::ivantsov_batch;
+    namespace ivantsov = zldsp::filter::ivantsov;
+    using zldsp::filter::FilterDesign::kMaxCascadeNum;
+
+    // the accuracy of hwy/contrib/math is a few ulp, the formulas add a few more roundings
+    constexpr double kTolerance = 1e-11;
+
+    double getRelativeError(const double x, const double reference) {
+        return std::abs(x - reference) / std::max(std::abs(reference), 1e-300);
+    }
+
+    /**
+     * the normalized frequencies, dense around the spline between kSplineWA and kSplineWB
+     */
+    std::vector<double> getW0s() {
+        std::vector<double> w0s;
+        for (size_t i = 0; i < 997; ++i) {
+            w0s.push_back(1e-4 * std::pow(1e4, static_cast<double>(i) / 996.0));
+        }
+        for (size_t i = 0; i <= 200; ++i) {
+            w0s.push_back(ivantsov::kSplineWA - 1e-3 + (ivantsov::kSplineWB - ivantsov::kSplineWA + 2e-3)
+                          * static_cast<double>(i) / 200.0);
+        }
+        w0s.push_back(ivantsov::kSplineWA);
+        w0s.push_back(ivantsov::kSplineWB);
+        return w0s;
+    }
+
+    /**
+     * evaluate the kernel on every value at every position of every size, the results must not depend on either
+     * @return the largest error against the scalar reference
+     */
+    template <typename Kernel, typename Reference>
+    double checkAllPositions(const std::vector<double>& xs, Kernel&& kernel, Reference&& reference) {
+        double max_error{0.0};
+        std::vector<double> first(xs.size());
+        kernel(xs.data(), first.data(), xs.size());
+        for (size_t k = 0; k < xs.size(); ++k) {
+            max_error = std::max(max_error, getRelativeError(first[k], reference(xs[k])));
+        }
+        std::array<double, kMaxCascadeNum> inputs{}, outputs{};
+        for (size_t size = 1; size <= kMaxCascadeNum; ++size) {
+            for (size_t k = 0; k < xs.size(); ++k) {
+                const auto pos = k % size;
+                std::fill(inputs.begin(), inputs.end(), xs[(k + 1) % xs.size()]);
+                inputs[pos] = xs[k];
+                kernel(inputs.data(), outputs.data(), size);
+                ZL_CHECK(outputs[pos] == first[k]);
+            }
+        }
+        return max_error;
+    }
+}
+
+int main() {
+    const auto w0s = getW0s();
+    const auto w2_error = checkAllPositions(w0s, batch::getWrappingW2, [](const double w0) {
+        return ivantsov::getWrappingW2(w0);
+    });
+    std::printf("getWrappingW2: %.3e\n", w2_error);
+    ZL_CHECK(w2_error <= kTolerance);
+
+    std::vector<double> w2s(w0s.size());
+    for (size_t k = 0; k < w0s.size(); ++k) {
+        w2s[k] = ivantsov::getWrappingW2(w0s[k]);
+    }
+    const auto phi_error = checkAllPositions(w2s, batch::getPhi, [](const double w2) {
+        const auto root = std::sqrt(w2 + ivantsov::kSigmaSq);
+        return (ivantsov::kPi - root) / (ivantsov::kPi + root);
+    });
+    std::printf("getPhi: %.3e\n", phi_error);
+    ZL_CHECK(phi_error <= kTolerance);
+
+    // the cascade cores of every order and Q, the stages share one w2 as in get2Cascade
+    double core_error{0.0};
+    std::array<double, kMaxCascadeNum> qs{};
+    batch::CascadeCore core;
+    for (const auto w2 : w2s) {
+        for (const auto q0 : {0.1, 0.707, 3.0, 30.0}) {
+            for (size_t n = 2; n <= 2 * kMaxCascadeNum; n += 2) {
+                const auto stage_qs = std::span{qs.data(), n / 2};
+                zldsp::filter::FilterDesign::getCascadeQs(n, q0, stage_qs);
+                core.compute(w2, stage_qs);
+                for (size_t i = 0; i < stage_qs.size(); ++i) {
+                    const auto zeta2 = 1.0 / (4.0 * stage_qs[i] * stage_qs[i]);
+                    const auto z_term = 2.0 * zeta2 - 1.0;
+                    const auto kappa = w2 * z_term + ivantsov::kSigmaSq;
+                    const auto v = std::sqrt(std::abs(
+                        w2 * w2 + 2.0 * ivantsov::kSigmaSq * w2 * z_term + ivantsov::kSigma4));
+                    const auto pi_sq_term = ivantsov::kPi * std::sqrt(std::abs(2.0 * (v + kappa)));
+                    core_error = std::max(core_error, getRelativeError(core.vs[i], v));
+                    core_error = std::max(core_error, getRelativeError(core.pi_sq_terms[i], pi_sq_term));
+                    core_error = std::max(core_error,
+                                          getRelativeError(core.ds[i], ivantsov::kPiSq + pi_sq_term + v));
+                }
+            }
+        }
+    }
+    std::printf("CascadeCore: %.3e\n", core_error);
+    ZL_CHECK(core_error <= kTolerance);
+
+    // the Q values of a cascade follow the scalar formula exactly
+    for (size_t n = 2; n <= 2 * kMaxCascadeNum; n += 2) {
+        for (const auto q0 : {0.1, 0.707, 3.0, 30.0}) {
+            zldsp::filter::FilterDesign::getCascadeQs(n, q0, std::span{qs.data(), n / 2});
+            const size_t number = n / 2;
+            const auto theta0 = std::numbers::pi / static_cast<double>(number) / 4;
+            const auto scale = std::pow(std::sqrt(2.0) * q0, 1 / static_cast<double>(number));
+            const auto rescale_base = std::log10(std::sqrt(2.0) * q0)
+                                      / std::pow(static_cast<double>(n), 1.5) * 12;
+            for (size_t i = 0; i < number; ++i) {
+                const auto centered = static_cast<double>(i) - static_cast<double>(number) / 2 + 0.5;
+                const auto theta = theta0 * static_cast<double>(2 * i + 1);
+                const auto q = 1.0 / 2.0 / std::cos(theta) * scale * std::pow(2, centered * rescale_base);
+                ZL_CHECK(qs[i] == q);
+            }
+        }
+    }
+    return zltest::finish();
+}
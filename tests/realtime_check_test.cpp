@@ -0,0 +1,122 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+// sweep the bus layouts, filter structures, side-chain and bypass settings and random parameters
+// through the audio callback of the plugin, every real-time violation inside it fails the test
+// it is only built with ZL_RT_SAFETY_CHECK, see tests/CMakeLists.txt
+
+#include <array>
+#include <cstdio>
+
+#include "test_helper.hpp"
+#include "PluginProcessor.hpp"
+
+namespace {
+    constexpr double kSampleRate = 48000.0;
+    constexpr int kMaxBlockSize = 512;
+    constexpr int kNumBlocks = 24;
+
+    void setParameter(PluginProcessor& processor, const juce::String& id, const float value) {
+        auto* para = processor.parameters_.getParameter(id);
+        para->beginChangeGesture();
+        para->setValueNotifyingHost(value);
+        para->endChangeGesture();
+    }
+
+    /**
+     * set all parameters to random values, the sweep forces the settings under test afterward
+     */
+    void randomizeParameters(PluginProcessor& processor, juce::Random& random) {
+        for (auto* para : processor.getParameters()) {
+            if (auto* ranged = dynamic_cast<juce::RangedAudioParameter*>(para)) {
+                ranged->setValueNotifyingHost(random.nextFloat());
+            }
+        }
+    }
+
+    juce::AudioProcessor::BusesLayout getLayout(const juce::AudioChannelSet& main, const juce::AudioChannelSet& aux) {
+        juce::AudioProcessor::BusesLayout layout;
+        layout.inputBuses.add(main);
+        layout.inputBuses.add(aux);
+        layout.outputBuses.add(main);
+        return layout;
+    }
+
+    /**
+     * process blocks of random sizes and noise in float and double, as processBlock and processBlockBypassed
+     */
+    template <typename FloatType>
+    void processBlocks(PluginProcessor& processor, juce::Random& random, const bool host_bypass) {
+        juce::AudioBuffer<FloatType> buffer(processor.getTotalNumInputChannels(), kMaxBlockSize);
+        juce::MidiBuffer midi;
+        for (int block = 0; block < kNumBlocks; ++block) {
+            // the first block may be empty and the rest covers odd sizes
+            const auto num_samples = block == 0 ? 0 : 1 + random.nextInt(kMaxBlockSize);
+            buffer.setSize(buffer.getNumChannels(), num_samples, false, false, true);
+            for (int chan = 0; chan < buffer.getNumChannels(); ++chan) {
+                auto* data = buffer.getWritePointer(chan);
+                for (int i = 0; i < num_samples; ++i) {
+                    data[i] = static_cast<FloatType>(random.nextFloat() * 2.f - 1.f);
+                }
+            }
+            if (host_bypass) {
+                processor.processBlockBypassed(buffer, midi);
+            } else {
+                processor.processBlock(buffer, midi);
+            }
+        }
+    }
+}
+
+int main() {
+    const juce::ScopedJuceInitialiser_GUI juce_initialiser;
+    PluginProcessor processor;
+    juce::Random random{42};
+
+    const std::array layouts{
+        getLayout(juce::AudioChannelSet::mono(), juce::AudioChannelSet::disabled()),
+        getLayout(juce::AudioChannelSet::mono(), juce::AudioChannelSet::mono()),
+        getLayout(juce::AudioChannelSet::mono(), juce::AudioChannelSet::stereo()),
+        getLayout(juce::AudioChannelSet::stereo(), juce::AudioChannelSet::disabled()),
+        getLayout(juce::AudioChannelSet::stereo(), juce::AudioChannelSet::mono()),
+        getLayout(juce::AudioChannelSet::stereo(), juce::AudioChannelSet::stereo()),
+    };
+    const auto num_structures = zlp::PFilterStructure::kChoices.size();
+
+    for (const auto& layout : layouts) {
+        ZL_CHECK(processor.setBusesLayout(layout));
+        processor.prepareToPlay(kSampleRate, kMaxBlockSize);
+        for (int structure = 0; structure < num_structures; ++structure) {
+            for (const auto ext_side : {false, true}) {
+                for (const auto bypass : {false, true}) {
+                    const auto num_violations_before = zlchore::thread::getNumRealtimeViolations();
+                    randomizeParameters(processor, random);
+                    setParameter(processor, zlp::PFilterStructure::kID, zlp::PFilterStructure::convertTo01(structure));
+                    setParameter(processor, zlp::PExtSide::kID, zlp::PExtSide::convertTo01(ext_side));
+                    setParameter(processor, zlp::PBypass::kID, zlp::PBypass::convertTo01(bypass ? 1 : 0));
+                    processBlocks<float>(processor, random, false);
+                    processBlocks<double>(processor, random, false);
+                    processBlocks<float>(processor, random, true);
+                    processBlocks<double>(processor, random, true);
+                    const auto num_violations = zlchore::thread::getNumRealtimeViolations() - num_violations_before;
+                    if (num_violations > 0) {
+                        std::fprintf(stderr, "%d violation(s): main %d, aux %d, structure %d, ext side %d, bypass %d\n",
+                                     num_violations, layout.getMainInputChannels(), layout.getNumChannels(true, 1),
+                                     structure, static_cast<int>(ext_side), static_cast<int>(bypass));
+                    }
+                }
+            }
+        }
+        processor.releaseResources();
+    }
+
+    std::printf("real-time violations: %d\n", zlchore::thread::getNumRealtimeViolations());
+    ZL_CHECK(zlchore::thread::getNumRealtimeViolations() == 0);
+    return zltest::finish();
+}
@@ -0,0 +1,118 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "test_helper.hpp"
+#include "dsp/filter/ideal_filter/ideal.hpp"
+#include "dsp/vector/vector.hpp"
+
+namespace {
+    // the sizes of ResponsePanel
+    constexpr size_t kNumBands = 24;
+    constexpr size_t kFilterSize = 16;
+    constexpr size_t kNumPoints = 400;
+    constexpr double kSampleRate = 48000.0;
+
+    using Filter = zldsp::filter::Ideal<float, kFilterSize>;
+
+    volatile float sink = 0.f;
+
+    /**
+     * the cached curve of a band, keyed like ResponsePanel::CurveFingerprint
+     */
+    struct Curve {
+        zldsp::filter::FilterParameters para{}, fingerprint{};
+        bool is_valid{false};
+        zldsp::vector::aligned_vector<float> mags = zldsp::vector::aligned_vector<float>(kNumPoints);
+        zldsp::vector::aligned_vector<float> summed = zldsp::vector::aligned_vector<float>(kNumPoints);
+    };
+
+    void computeCurve(Filter& filter, zldsp::vector::aligned_vector<float>& ws, Curve& curve) {
+        filter.forceUpdate(curve.para);
+        filter.updateMagnitudeSquare(ws, curve.mags);
+        zldsp::vector::sqr_mag_to_db(curve.mags.data(), curve.mags.size());
+        curve.fingerprint = curve.para;
+        curve.is_valid = true;
+    }
+}
+
+int main() {
+    zldsp::vector::aligned_vector<float> ws(kNumPoints);
+    for (size_t i = 0; i < kNumPoints; ++i) {
+        const auto freq = 10.0 * std::pow(2200.0, static_cast<double>(i) / static_cast<double>(kNumPoints - 1));
+        ws[i] = static_cast<float>(freq * (2.0 * 3.141592653589793 / kSampleRate));
+    }
+    std::array<Filter, kNumBands> filters;
+    std::array<Curve, kNumBands> curves;
+    for (size_t band = 0; band < kNumBands; ++band) {
+        filters[band].prepare(kSampleRate);
+        curves[band].para = {
+            static_cast<zldsp::filter::FilterType>(band % 3 == 0 ? zldsp::filter::kPeak : band % 3 == 1
+                                                       ? zldsp::filter::kLowShelf
+                                                       : zldsp::filter::kHighShelf),
+            static_cast<size_t>(2 + 2 * (band % 4)), 40.0 * std::pow(1.3, static_cast<double>(band)),
+            static_cast<double>(band % 7) - 3.0, 0.707
+        };
+        computeCurve(filters[band], ws, curves[band]);
+    }
+    zldsp::vector::aligned_vector<float> sum(kNumPoints, 0.f);
+
+    // a change of the dB scale or the size marks every band, before the fingerprints every band was recomputed
+    const auto recompute_ns = zltest::timeNanoseconds([&]() {
+        for (size_t band = 0; band < kNumBands; ++band) {
+            computeCurve(filters[band], ws, curves[band]);
+        }
+        sink = sink + curves[0].mags[0];
+    }, 256);
+    size_t num_recomputed{0};
+    const auto fingerprint_ns = zltest::timeNanoseconds([&]() {
+        for (size_t band = 0; band < kNumBands; ++band) {
+            if (!(curves[band].is_valid && curves[band].para == curves[band].fingerprint)) {
+                computeCurve(filters[band], ws, curves[band]);
+                num_recomputed += 1;
+            }
+        }
+        sink = sink + curves[0].mags[0];
+    }, 256);
+
+    // dragging one band, before the incremental sums every frame added all bands of the stereo mode
+    const auto full_sum_ns = zltest::timeNanoseconds([&]() {
+        std::ranges::fill(sum, 0.f);
+        for (size_t band = 0; band < kNumBands; ++band) {
+            zldsp::vector::copy(curves[band].summed.data(), curves[band].mags.data(), kNumPoints);
+            zldsp::vector::add(sum.data(), curves[band].summed.data(), kNumPoints);
+        }
+        sink = sink + sum[0];
+    }, 256);
+    const auto drag_ns = zltest::timeNanoseconds([&]() {
+        auto& curve = curves[5];
+        curve.para.gain = curve.para.gain > 0.0 ? -2.0 : 2.0;
+        computeCurve(filters[5], ws, curve);
+        sink = sink + curve.mags[0];
+    }, 256);
+    const auto incremental_sum_ns = zltest::timeNanoseconds([&]() {
+        auto& curve = curves[5];
+        for (size_t i = 0; i < kNumPoints; ++i) {
+            sum[i] += curve.mags[i] - curve.summed[i];
+            curve.summed[i] = curve.mags[i];
+        }
+        sink = sink + sum[0];
+    }, 256);
+
+    std::printf("%zu bands, %zu points, %zu cascaded filters per band\n", kNumBands, kNumPoints, kFilterSize);
+    std::printf("scale or size change: recompute all %8.2f us, fingerprints %8.3f us, %zu recomputed\n",
+                recompute_ns * 1e-3, fingerprint_ns * 1e-3, num_recomputed);
+    std::printf("drag one band:        curve %8.2f us, full sum %8.3f us, incremental sum %8.3f us\n",
+                drag_ns * 1e-3, full_sum_ns * 1e-3, incremental_sum_ns * 1e-3);
+    return 0;
+}
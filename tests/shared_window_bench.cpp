@@ -0,0 +1,110 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+#include <array>
+#include <cstdio>
+#include <memory>
+#include <set>
+#include <vector>
+
+#include "test_helper.hpp"
+#include "dsp/fft/zldsp_fft_window_cache.hpp"
+
+namespace {
+    using zldsp::fft::SharedWindow;
+    using zldsp::fft::WindowType;
+
+    struct WindowSpec {
+        size_t order;
+        WindowType type;
+        float scale;
+    };
+
+    /**
+     * the windows of one instance at 48 kHz, with the editor open
+     * the three StereoFIRProcessor (orders 9, 10 and 13) and the three FFTPanel resolutions (orders 14, 12 and 10)
+     */
+    std::vector<WindowSpec> getInstanceWindows() {
+        std::vector<WindowSpec> specs;
+        for (const size_t order : {9, 10, 13}) {
+            const auto size = static_cast<float>(static_cast<size_t>(1) << order);
+            specs.push_back({order, WindowType::kHanning, 2.f / size});
+            specs.push_back({order, WindowType::kHanning, 2.f / 3.f});
+            specs.push_back({order, WindowType::kHanningSqr, 2.f / 3.f});
+        }
+        for (const size_t order : {14, 12, 10}) {
+            specs.push_back({order, WindowType::kHanning, 2.f / static_cast<float>(static_cast<size_t>(1) << order)});
+        }
+        return specs;
+    }
+
+    /**
+     * a window owned by one instance, as before the cache
+     */
+    SharedWindow getOwnWindow(const WindowSpec& spec) {
+        zldsp::vector::aligned_vector<float> window(static_cast<size_t>(1) << spec.order);
+        if (spec.type == WindowType::kHanning) {
+            zldsp::fft::createPeriodicHanning<float>(window, spec.scale);
+        } else {
+            zldsp::fft::createPeriodicHanning<float>(window);
+            for (auto& x : window) {
+                x = spec.scale * x * x;
+            }
+        }
+        return std::make_shared<const zldsp::vector::aligned_vector<float>>(std::move(window));
+    }
+
+    /**
+     * @return the bytes of all distinct windows held by the instances
+     */
+    size_t getWindowBytes(const std::vector<std::vector<SharedWindow>>& instances) {
+        std::set<const void*> seen;
+        size_t bytes{0};
+        for (const auto& windows : instances) {
+            for (const auto& window : windows) {
+                if (seen.insert(window.get()).second) {
+                    bytes += window->size() * sizeof(float);
+                }
+            }
+        }
+        return bytes;
+    }
+}
+
+int main() {
+    const auto specs = getInstanceWindows();
+    std::printf("%10s %14s %14s %14s %14s\n", "instances", "own KiB", "shared KiB", "own us", "shared us");
+    for (const size_t num_instances : {1, 8, 32, 128}) {
+        std::vector<std::vector<SharedWindow>> own(num_instances), shared(num_instances);
+        // the instances are created one after another, so the first one fills the cache and the rest reuse it
+        const auto own_ns = zltest::timeNanoseconds([&]() {
+            for (auto& windows : own) {
+                windows.clear();
+                for (const auto& spec : specs) {
+                    windows.push_back(getOwnWindow(spec));
+                }
+            }
+        }, 8);
+        const auto shared_ns = zltest::timeNanoseconds([&]() {
+            for (auto& windows : shared) {
+                windows.clear();
+            }
+            for (auto& windows : shared) {
+                for (const auto& spec : specs) {
+                    windows.push_back(zldsp::fft::getSharedWindow(static_cast<size_t>(1) << spec.order,
+                                                                  spec.type, spec.scale));
+                }
+            }
+        }, 8);
+        std::printf("%10zu %14.1f %14.1f %14.1f %14.1f\n", num_instances,
+                    static_cast<double>(getWindowBytes(own)) / 1024.0,
+                    static_cast<double>(getWindowBytes(shared)) / 1024.0, own_ns * 1e-3, shared_ns * 1e-3);
+    }
+    return 0;
+}
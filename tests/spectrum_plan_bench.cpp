@@ -0,0 +1,106 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "test_helper.hpp"
+#include "dsp/analyzer/fft_analyzer/spectrum_blender.hpp"
+#include "dsp/analyzer/fft_analyzer/spectrum_decayer.hpp"
+#include "dsp/analyzer/fft_analyzer/spectrum_plan.hpp"
+#include "dsp/analyzer/fft_analyzer/spectrum_smoother.hpp"
+#include "dsp/analyzer/fft_analyzer/spectrum_tilter.hpp"
+
+namespace {
+    /**
+     * time the step of FFTPanel::runFFT between the FFTs and the path, for one source in microseconds
+     */
+    void benchSampleRate(const double sample_rate, const int middle_order) {
+        const std::array<size_t, 3> fft_sizes{
+            static_cast<size_t>(1) << (middle_order + 2), static_cast<size_t>(1) << middle_order,
+            static_cast<size_t>(1) << (middle_order - 2)
+        };
+        const std::array<float, 3> scales{0.25f, 1.f, 4.f};
+        const auto frequencies = zldsp::analyzer::SpectrumBlender::createFrequencyGrid(
+            fft_sizes[0], fft_sizes[1], fft_sizes[2], sample_rate);
+
+        std::mt19937 generator{42};
+        std::uniform_real_distribution<float> distribution{1e-6f, 1.f};
+        std::array<std::vector<float>, 3> inputs, spectra;
+        std::array<zldsp::analyzer::SpectrumSmoother, 3> smoothers;
+        for (size_t s = 0; s < 3; ++s) {
+            inputs[s].resize(fft_sizes[s] / 2 + 1);
+            std::ranges::generate(inputs[s], [&]() { return distribution(generator); });
+            smoothers[s].prepare(fft_sizes[s]);
+            smoothers[s].setSmoothOCT(1.0 / 6.0);
+        }
+
+        zldsp::analyzer::SpectrumPlan plan;
+        plan.prepare(frequencies, {inputs[0].size(), inputs[1].size(), inputs[2].size()}, sample_rate);
+        plan.setResolutionScales(scales);
+        plan.setTiltSlope(4.5);
+        zldsp::analyzer::SpectrumTilter tilter;
+        tilter.prepareSpectrum(frequencies.size());
+        tilter.setTiltSlope(frequencies, 4.5);
+        zldsp::analyzer::SpectrumDecayer decayer;
+        decayer.prepareSpectrum(frequencies.size());
+        decayer.setDecaySpeed(60.f, -72.f, 0.15f);
+        std::vector<float> output(frequencies.size());
+
+        const auto restore = [&]() {
+            for (size_t s = 0; s < 3; ++s) {
+                std::ranges::copy(inputs[s], spectra[s].begin());
+            }
+        };
+        for (size_t s = 0; s < 3; ++s) {
+            spectra[s].resize(inputs[s].size());
+        }
+
+        const auto smooth_ns = zltest::timeNanoseconds([&]() {
+            restore();
+            for (size_t s = 0; s < 3; ++s) {
+                smoothers[s].smooth(spectra[s]);
+            }
+        }, 64);
+        const auto copy_ns = zltest::timeNanoseconds([&]() { restore(); }, 64);
+        const auto old_ns = zltest::timeNanoseconds([&]() {
+            restore();
+            for (size_t s = 0; s < 3; ++s) {
+                zldsp::vector::multiply(spectra[s].data(), scales[s], spectra[s].size());
+            }
+            zldsp::analyzer::SpectrumBlender::blend(output, frequencies, spectra[0], spectra[1], spectra[2],
+                                                    sample_rate);
+            zldsp::vector::sqr_mag_to_db(output.data(), output.size());
+            tilter.tilt(output);
+            decayer.decay(output);
+        }, 64);
+        const auto plan_ns = zltest::timeNanoseconds([&]() {
+            restore();
+            plan.process(output, {spectra[0], spectra[1], spectra[2]});
+            zldsp::vector::sqr_mag_to_db(output.data(), output.size());
+            decayer.decay(output);
+        }, 64);
+        std::printf("%8.0f %8zu %12.2f %12.2f %12.2f %8.2f\n", sample_rate, frequencies.size(),
+                    (smooth_ns - copy_ns) * 1e-3, (old_ns - copy_ns) * 1e-3, (plan_ns - copy_ns) * 1e-3,
+                    (old_ns - copy_ns) / (plan_ns - copy_ns));
+    }
+}
+
+int main() {
+    std::printf("%8s %8s %12s %12s %12s %8s\n", "rate", "points", "smooth (us)", "blend (us)", "plan (us)", "ratio");
+    // the middle orders of zlp::getScaledOrder(sample_rate, 12)
+    benchSampleRate(44100.0, 12);
+    benchSampleRate(48000.0, 12);
+    benchSampleRate(96000.0, 13);
+    benchSampleRate(192000.0, 14);
+    return 0;
+}
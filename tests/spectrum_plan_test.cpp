@@ -0,0 +1,115 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "test_helper.hpp"
+#include "dsp/analyzer/fft_analyzer/spectrum_blender.hpp"
+#include "dsp/analyzer/fft_analyzer/spectrum_decayer.hpp"
+#include "dsp/analyzer/fft_analyzer/spectrum_plan.hpp"
+#include "dsp/analyzer/fft_analyzer/spectrum_tilter.hpp"
+
+namespace {
+    constexpr double kSampleRate = 48000.0;
+    // the orders FFTPanel uses at 48 kHz
+    constexpr std::array<size_t, 3> kFFTSizes{1 << 14, 1 << 12, 1 << 10};
+    constexpr std::array<float, 3> kScales{0.25f, 1.f, 4.f};
+    // the slopes of PFFTTilt and the speeds of PFFTSpeed
+    constexpr std::array<float, 5> kSlopes{0.f, 1.5f, 3.f, 4.5f, 6.f};
+    constexpr std::array<double, 3> kSpeeds{4.0, 1.0, 0.25};
+    constexpr size_t kNumFrames = 32;
+
+    /**
+     * random power spectra, log-uniform between -100 dB and 0 dB
+     */
+    std::vector<float> randomSpectrum(const size_t size, std::mt19937& generator) {
+        std::uniform_real_distribution<float> distribution{-10.f, 0.f};
+        std::vector<float> spectrum(size);
+        std::ranges::generate(spectrum, [&]() { return std::pow(10.f, distribution(generator)); });
+        return spectrum;
+    }
+
+    /**
+     * run both post-FFT paths for several frames and return the largest difference in dB
+     * the old path scales each resolution, blends, converts to dB and tilts, the plan does all but the dB in one pass
+     * @param skip_largest feed the middle resolution as the lowest one, as FFTPanel does from kSkipLargestFFT
+     */
+    double compareWithBlendAndTilt(const float slope, const double speed, const bool skip_largest,
+                                   std::mt19937& generator) {
+        const auto frequencies = zldsp::analyzer::SpectrumBlender::createFrequencyGrid(
+            kFFTSizes[0], kFFTSizes[1], kFFTSizes[2], kSampleRate);
+        const auto first = skip_largest ? size_t(1) : size_t(0);
+        const std::array<size_t, 3> sizes{kFFTSizes[first] / 2 + 1, kFFTSizes[1] / 2 + 1, kFFTSizes[2] / 2 + 1};
+        const std::array<float, 3> scales{kScales[first], kScales[1], kScales[2]};
+
+        zldsp::analyzer::SpectrumPlan plan;
+        plan.prepare(frequencies, sizes, kSampleRate);
+        plan.setResolutionScales(scales);
+        plan.setTiltSlope(slope);
+        zldsp::analyzer::SpectrumTilter tilter;
+        tilter.prepareSpectrum(frequencies.size());
+        tilter.setTiltSlope(frequencies, slope);
+        zldsp::analyzer::SpectrumDecayer plan_decayer, old_decayer;
+        for (auto* decayer : {&plan_decayer, &old_decayer}) {
+            decayer->prepareSpectrum(frequencies.size());
+            decayer->setDecaySpeed(60.f, -72.f, static_cast<float>(0.15 / speed));
+        }
+
+        std::vector<float> plan_output(frequencies.size()), old_output(frequencies.size());
+        double max_error = 0.0;
+        for (size_t frame = 0; frame < kNumFrames; ++frame) {
+            std::array<std::vector<float>, 3> spectra;
+            for (size_t s = 0; s < 3; ++s) {
+                spectra[s] = randomSpectrum(sizes[s], generator);
+            }
+            plan.process(plan_output, {spectra[0], spectra[1], spectra[2]});
+            zldsp::vector::sqr_mag_to_db(plan_output.data(), plan_output.size());
+            plan_decayer.decay(plan_output);
+
+            for (size_t s = 0; s < 3; ++s) {
+                zldsp::vector::multiply(spectra[s].data(), scales[s], spectra[s].size());
+            }
+            zldsp::analyzer::SpectrumBlender::blend(old_output, frequencies, spectra[0], spectra[1], spectra[2],
+                                                    kSampleRate);
+            zldsp::vector::sqr_mag_to_db(old_output.data(), old_output.size());
+            tilter.tilt(old_output);
+            old_decayer.decay(old_output);
+
+            for (size_t i = 0; i < frequencies.size(); ++i) {
+                max_error = std::max(max_error, static_cast<double>(std::abs(plan_output[i] - old_output[i])));
+            }
+        }
+        return max_error;
+    }
+}
+
+int main() {
+    // the plan applies the tilt as a power gain and folds the scales into its weights, so the two paths
+    // only differ by float rounding, which stays below a thousandth of a dB
+    constexpr double kMaxErrorDB = 1e-3;
+    std::mt19937 generator{42};
+    double max_error = 0.0;
+    for (const auto skip_largest : {false, true}) {
+        for (const auto slope : kSlopes) {
+            for (const auto speed : kSpeeds) {
+                const auto error = compareWithBlendAndTilt(slope, speed, skip_largest, generator);
+                ZL_CHECK(error <= kMaxErrorDB);
+                max_error = std::max(max_error, error);
+            }
+        }
+    }
+    std::printf("plan vs blend + tilt: max error %.3e dB\n", max_error);
+    return zltest::finish();
+}
@@ -0,0 +1,180 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "test_helper.hpp"
+#include "dsp/analyzer/fft_analyzer/spectrum_smoother.hpp"
+#include "dsp/vector/vector.hpp"
+
+namespace {
+    namespace hn = hwy::HWY_NAMESPACE;
+
+    /**
+     * a Highway candidate for SpectrumSmoother, kept here so that it can be re-measured on other targets
+     * the moving sums are taken from a two-level float prefix sum: an exclusive prefix sum inside each block of
+     * kBlockSize bins, scanned kLanes blocks at a time with one block per lane (so stored transposed), and a
+     * compensated hi/lo prefix sum of the block totals
+     * the moving sums gather both levels at the precomputed window bounds
+     */
+    class TwoLevelSmoother {
+    public:
+        static constexpr size_t kBlockShift = 5;
+        static constexpr size_t kBlockSize = static_cast<size_t>(1) << kBlockShift;
+        static constexpr size_t kLanes = hn::MaxLanes(hn::ScalableTag<float>());
+
+        explicit TwoLevelSmoother(const size_t fft_size) {
+            const auto num_bins = fft_size / 2 + 1;
+            for (auto* v : {&low_block_, &high_block_, &low_pos_, &high_pos_}) {
+                v->resize(num_bins);
+            }
+            count_req_.resize(num_bins);
+            // the prefix sum has num_bins + 1 entries, the blocks are scanned in groups of kLanes
+            num_groups_ = (num_bins + kBlockSize * kLanes) / (kBlockSize * kLanes);
+            num_blocks_ = num_groups_ * kLanes;
+            padded_.resize(num_blocks_ * kBlockSize, 0.f);
+            local_sum_.resize(num_blocks_ * kBlockSize);
+            block_total_.resize(num_blocks_);
+            block_sum_hi_.resize(num_blocks_);
+            block_sum_lo_.resize(num_blocks_);
+        }
+
+        void setSmoothOCT(const double smooth_oct) {
+            const double factor = std::pow(2.0, smooth_oct * 0.5);
+            const size_t max_idx = count_req_.size();
+            for (size_t i = 0; i < count_req_.size(); ++i) {
+                const auto low_idx = static_cast<size_t>(std::round(static_cast<double>(i) / factor));
+                const auto high_idx = std::min(max_idx,
+                                               static_cast<size_t>(std::round(static_cast<double>(i) * factor) + 1.0));
+                low_block_[i] = static_cast<int32_t>(low_idx >> kBlockShift);
+                high_block_[i] = static_cast<int32_t>(high_idx >> kBlockShift);
+                low_pos_[i] = static_cast<int32_t>(getTransposedPosition(low_idx));
+                high_pos_[i] = static_cast<int32_t>(getTransposedPosition(high_idx));
+                count_req_[i] = 1.0f / static_cast<float>(std::max<size_t>(1, high_idx - low_idx));
+            }
+        }
+
+        void smooth(const std::span<float> data) {
+            applyBoxcarAverage(data);
+            applyBoxcarAverage(data);
+        }
+
+    private:
+        zldsp::vector::aligned_vector<int32_t> low_block_, high_block_, low_pos_, high_pos_;
+        zldsp::vector::aligned_vector<float> count_req_;
+        size_t num_groups_{0}, num_blocks_{0};
+        zldsp::vector::aligned_vector<float> padded_, local_sum_;
+        zldsp::vector::aligned_vector<float> block_total_, block_sum_hi_, block_sum_lo_;
+
+        static size_t getTransposedPosition(const size_t idx) {
+            const auto block = idx >> kBlockShift;
+            const auto k = idx & (kBlockSize - 1);
+            return ((block / kLanes) * kBlockSize + k) * kLanes + block % kLanes;
+        }
+
+        void applyBoxcarAverage(const std::span<float> data) {
+            static constexpr hn::ScalableTag<float> d;
+            static constexpr hn::RebindToSigned<decltype(d)> di;
+            zldsp::vector::copy(padded_.data(), data.data(), data.size());
+            // exclusive prefix sum inside each block, lane j of a group scans block group * kLanes + j
+            const auto v_stride = hn::Mul(hn::Iota(di, 0), hn::Set(di, static_cast<int32_t>(kBlockSize)));
+            for (size_t group = 0; group < num_groups_; ++group) {
+                const auto* HWY_RESTRICT in = padded_.data() + group * kLanes * kBlockSize;
+                auto* HWY_RESTRICT out = local_sum_.data() + group * kLanes * kBlockSize;
+                auto v_sum = hn::Zero(d);
+                for (size_t k = 0; k < kBlockSize; ++k) {
+                    hn::Store(v_sum, d, out + k * kLanes);
+                    v_sum = hn::Add(v_sum, hn::GatherIndex(d, in + k, v_stride));
+                }
+                hn::Store(v_sum, d, block_total_.data() + group * kLanes);
+            }
+            // exclusive compensated prefix sum of the block totals
+            float hi{0.f}, lo{0.f};
+            for (size_t block = 0; block < num_blocks_; ++block) {
+                block_sum_hi_[block] = hi;
+                block_sum_lo_[block] = lo;
+                const auto x = block_total_[block];
+                const auto s = hi + x;
+                const auto bp = s - hi;
+                lo += (hi - (s - bp)) + (x - bp);
+                hi = s + lo;
+                lo -= hi - s;
+            }
+            // moving sums from the differences of the two levels
+            const auto* HWY_RESTRICT hi_sum = block_sum_hi_.data();
+            const auto* HWY_RESTRICT lo_sum = block_sum_lo_.data();
+            const auto* HWY_RESTRICT local_sum = local_sum_.data();
+            const auto* HWY_RESTRICT count_req = count_req_.data();
+            auto* HWY_RESTRICT output = data.data();
+            size_t i = 0;
+            for (; i + kLanes <= data.size(); i += kLanes) {
+                const auto v_low_block = hn::LoadU(di, low_block_.data() + i);
+                const auto v_high_block = hn::LoadU(di, high_block_.data() + i);
+                auto v_sum = hn::Sub(hn::GatherIndex(d, hi_sum, v_high_block), hn::GatherIndex(d, hi_sum, v_low_block));
+                v_sum = hn::Add(v_sum, hn::Sub(hn::GatherIndex(d, lo_sum, v_high_block),
+                                               hn::GatherIndex(d, lo_sum, v_low_block)));
+                v_sum = hn::Add(v_sum, hn::Sub(hn::GatherIndex(d, local_sum, hn::LoadU(di, high_pos_.data() + i)),
+                                               hn::GatherIndex(d, local_sum, hn::LoadU(di, low_pos_.data() + i))));
+                hn::StoreU(hn::Mul(v_sum, hn::LoadU(d, count_req + i)), d, output + i);
+            }
+            for (; i < data.size(); ++i) {
+                const auto sum = (hi_sum[high_block_[i]] - hi_sum[low_block_[i]])
+                    + (lo_sum[high_block_[i]] - lo_sum[low_block_[i]])
+                    + (local_sum[high_pos_[i]] - local_sum[low_pos_[i]]);
+                output[i] = sum * count_req[i];
+            }
+        }
+    };
+}
+
+int main() {
+    std::printf("%10s %18s %18s %8s %12s\n", "fft size", "smoother (ns/bin)", "two-level (ns/bin)", "ratio",
+                "max rel err");
+    std::mt19937 generator{42};
+    std::uniform_real_distribution<float> distribution{1e-6f, 1.f};
+    for (const size_t fft_size : {1024, 4096, 16384, 65536}) {
+        std::vector<float> input(fft_size / 2 + 1), data(fft_size / 2 + 1), reference(fft_size / 2 + 1);
+        std::ranges::generate(input, [&]() { return distribution(generator); });
+        zldsp::analyzer::SpectrumSmoother smoother;
+        smoother.prepare(fft_size);
+        smoother.setSmoothOCT(1.0 / 6.0);
+        TwoLevelSmoother two_level{fft_size};
+        two_level.setSmoothOCT(1.0 / 6.0);
+
+        std::ranges::copy(input, reference.begin());
+        smoother.smooth(reference);
+        std::ranges::copy(input, data.begin());
+        two_level.smooth(data);
+        double max_error = 0.0;
+        for (size_t i = 0; i < data.size(); ++i) {
+            max_error = std::max(max_error, std::abs(static_cast<double>(data[i] - reference[i]) /
+                                                     static_cast<double>(reference[i])));
+        }
+
+        const auto copy_ns = zltest::timeNanoseconds([&]() { std::ranges::copy(input, data.begin()); }, 256);
+        const auto smoother_ns = zltest::timeNanoseconds([&]() {
+            std::ranges::copy(input, data.begin());
+            smoother.smooth(data);
+        }, 256) - copy_ns;
+        const auto two_level_ns = zltest::timeNanoseconds([&]() {
+            std::ranges::copy(input, data.begin());
+            two_level.smooth(data);
+        }, 256) - copy_ns;
+        const auto num = static_cast<double>(data.size());
+        std::printf("%10zu %18.3f %18.3f %8.3f %12.3e\n", fft_size, smoother_ns / num, two_level_ns / num,
+                    smoother_ns / two_level_ns, max_error);
+    }
+    return 0;
+}
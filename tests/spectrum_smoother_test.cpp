@@ -0,0 +1,125 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "test_helper.hpp"
+#include "dsp/analyzer/fft_analyzer/spectrum_smoother.hpp"
+
+namespace {
+    /**
+     * the scalar reference: a boxcar average from a double prefix sum, applied twice
+     */
+    class ReferenceSmoother {
+    public:
+        explicit ReferenceSmoother(const size_t num_bins)
+            : low_idx_(num_bins), high_idx_(num_bins), cum_sum_(num_bins + 1) {
+        }
+
+        void setSmoothOCT(const double smooth_oct) {
+            const double factor = std::pow(2.0, smooth_oct * 0.5);
+            const size_t max_idx = low_idx_.size();
+            for (size_t i = 0; i < low_idx_.size(); ++i) {
+                low_idx_[i] = static_cast<size_t>(std::round(static_cast<double>(i) / factor));
+                const auto upper = std::round(static_cast<double>(i) * factor) + 1.0;
+                high_idx_[i] = std::min(max_idx, static_cast<size_t>(upper));
+            }
+        }
+
+        void setSmoothERB(const double sample_rate, const double smooth_erb) {
+            const auto num_bins = low_idx_.size();
+            const auto delta_f = sample_rate / static_cast<double>((num_bins - 1) * 2);
+            const auto max_idx = static_cast<double>(num_bins - 1);
+            for (size_t i = 0; i < num_bins; ++i) {
+                const double half_width = (0.107939 * static_cast<double>(i) + 24.7 / delta_f) * smooth_erb * 0.5;
+                const double lower = std::max(0.0, static_cast<double>(i) - half_width);
+                const double upper = std::min(max_idx, static_cast<double>(i) + half_width);
+                low_idx_[i] = static_cast<size_t>(std::round(lower));
+                high_idx_[i] = std::min(num_bins, static_cast<size_t>(std::round(upper) + 1.0));
+            }
+        }
+
+        void smooth(std::vector<double>& data) {
+            applyBoxcarAverage(data);
+            applyBoxcarAverage(data);
+        }
+
+    private:
+        std::vector<size_t> low_idx_, high_idx_;
+        std::vector<double> cum_sum_;
+
+        void applyBoxcarAverage(std::vector<double>& data) {
+            cum_sum_[0] = 0.0;
+            for (size_t i = 0; i < data.size(); ++i) {
+                cum_sum_[i + 1] = cum_sum_[i] + data[i];
+            }
+            for (size_t i = 0; i < data.size(); ++i) {
+                const auto count = static_cast<double>(std::max<size_t>(1, high_idx_[i] - low_idx_[i]));
+                data[i] = (cum_sum_[high_idx_[i]] - cum_sum_[low_idx_[i]]) / count;
+            }
+        }
+    };
+
+    double getMaxRelativeError(const std::vector<float>& output, const std::vector<double>& reference) {
+        double max_error = 0.0;
+        for (size_t i = 0; i < output.size(); ++i) {
+            if (!std::isfinite(output[i])) {
+                return 1e300;
+            }
+            const auto error = std::abs(static_cast<double>(output[i]) - reference[i]) / reference[i];
+            max_error = std::max(max_error, error);
+        }
+        return max_error;
+    }
+}
+
+int main() {
+    // the power spectrum falls by 80 dB over the band, like a pink spectrum with a steep high cut
+    // the smoother rounds the double prefix sums back to float between the passes, allow at most 0.005 dB
+    constexpr double kMaxRelativeError = 1e-3;
+    std::mt19937 generator{42};
+    std::uniform_real_distribution<double> distribution{0.5, 1.5};
+
+    for (const size_t fft_size : {256, 4096, 32768}) {
+        const auto num_bins = fft_size / 2 + 1;
+        std::vector<double> spectrum(num_bins);
+        for (size_t i = 0; i < num_bins; ++i) {
+            const auto x = static_cast<double>(i) / static_cast<double>(num_bins - 1);
+            spectrum[i] = distribution(generator) * std::pow(10.0, -8.0 * x) / (1.0 + static_cast<double>(i));
+        }
+
+        zldsp::analyzer::SpectrumSmoother smoother;
+        smoother.prepare(fft_size);
+        ReferenceSmoother reference_smoother{num_bins};
+
+        for (const bool is_erb : {false, true}) {
+            if (is_erb) {
+                smoother.setSmoothERB(48000.0, 1.0);
+                reference_smoother.setSmoothERB(48000.0, 1.0);
+            } else {
+                smoother.setSmoothOCT(1.0 / 3.0);
+                reference_smoother.setSmoothOCT(1.0 / 3.0);
+            }
+            std::vector<float> output(spectrum.begin(), spectrum.end());
+            // the reference starts from the same float-rounded spectrum
+            std::vector<double> reference(output.begin(), output.end());
+            smoother.smooth(output);
+            reference_smoother.smooth(reference);
+
+            const auto max_error = getMaxRelativeError(output, reference);
+            std::printf("fft size %zu, %s: max relative error %.3e\n", fft_size, is_erb ? "erb" : "oct", max_error);
+            ZL_CHECK(max_error < kMaxRelativeError);
+        }
+    }
+    return zltest::finish();
+}
@@ -0,0 +1,201 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "test_helper.hpp"
+#include "zlp/stereo_fir_processor.hpp"
+
+namespace {
+    // one band per correction type (stereo, left, right, mid, side)
+    constexpr size_t kFilterNum = 5;
+    constexpr size_t kOrder = 10;
+    using Processor = zlp::StereoFIRProcessor<double, kFilterNum>;
+
+    /**
+     * the corrections of the five types, each type holds one band
+     */
+    class Corrections {
+    public:
+        explicit Corrections(const size_t num_bin) {
+            for (size_t band = 0; band < kFilterNum; ++band) {
+                reals_[band].resize(num_bin);
+                imags_[band].resize(num_bin);
+                on_indices_[band] = {band};
+            }
+        }
+
+        /**
+         * set the pure gains of the five types, the correction of each type is a constant
+         */
+        void setGains(const std::array<float, 5>& gains) {
+            for (size_t type = 0; type < 5; ++type) {
+                std::ranges::fill(reals_[type], gains[type]);
+                std::ranges::fill(imags_[type], 0.f);
+            }
+        }
+
+        /**
+         * set the same overall gains, with a general correction on stereo and its inverse on left and right
+         * every type but mid and side is then general, so the processor takes the spectral path
+         */
+        void setSpectralGains(const std::array<float, 5>& gains) {
+            setGains(gains);
+            for (size_t k = 0; k < reals_[0].size(); ++k) {
+                const auto c = std::polar(1.f + .4f * std::sin(.05f * static_cast<float>(k)),
+                                          .7f * std::cos(.031f * static_cast<float>(k)));
+                const auto inv_c = 1.f / c;
+                reals_[0][k] = gains[0] * c.real();
+                imags_[0][k] = gains[0] * c.imag();
+                for (const size_t type : {1, 2}) {
+                    reals_[type][k] = gains[type] * inv_c.real();
+                    imags_[type][k] = gains[type] * inv_c.imag();
+                }
+            }
+        }
+
+        /**
+         * set a correction which is not a gain on every type
+         */
+        void setGeneral() {
+            for (size_t type = 0; type < 5; ++type) {
+                for (size_t k = 0; k < reals_[type].size(); ++k) {
+                    const auto w = static_cast<float>(k) * static_cast<float>(type + 1);
+                    reals_[type][k] = .8f + .3f * std::cos(.013f * w);
+                    imags_[type][k] = .2f * std::sin(.021f * w);
+                }
+            }
+        }
+
+        void apply(Processor& processor) {
+            processor.updateCorrection(reals_, imags_, on_indices_);
+        }
+
+    private:
+        std::array<zldsp::vector::aligned_vector<float>, kFilterNum> reals_, imags_;
+        std::array<std::vector<size_t>, 5> on_indices_;
+    };
+
+    /**
+     * a step of the sequence: the gains, or a general correction if is_general
+     */
+    struct Step {
+        std::array<float, 5> gains;
+        bool is_general;
+    };
+
+    void process(Processor& processor, std::vector<double>& left, std::vector<double>& right,
+                 const size_t start, const size_t end) {
+        constexpr size_t kBlockSize = 160;
+        for (size_t i = start; i < end; i += kBlockSize) {
+            const auto num_samples = std::min(kBlockSize, end - i);
+            std::array<double*, 2> pointers{left.data() + i, right.data() + i};
+            processor.process<true, true, true, true, true>(std::span<double*>(pointers), num_samples, false);
+        }
+    }
+}
+
+int main() {
+    std::unique_ptr<zldsp::fft::RFFT<float>> fast_fft, spectral_fft;
+    Processor fast{fast_fft, kOrder, 0}, spectral{spectral_fft, kOrder, 0};
+    fast.setOrder(kOrder);
+    fast.reset();
+    spectral.setOrder(kOrder);
+    spectral.reset();
+    Corrections fast_corrections{fast.getNumBin()}, spectral_corrections{spectral.getNumBin()};
+
+    // identity, per-channel gains, gains on the sum and the difference (including a nearly mono and a swapped
+    // image), a general correction in between, so the classification flips at the frame boundaries
+    const std::vector<Step> steps{
+        {{1.f, 1.f, 1.f, 1.f, 1.f}, false},
+        {{.5f, 1.f, 1.f, 1.f, 1.f}, false},
+        {{1.f, 2.f, .25f, 1.f, 1.f}, false},
+        {{1.f, 1.f, 1.f, 1.5f, 1.f}, false},
+        {{1.f, 1.f, 1.f, 1.f, 1e-3f}, false},
+        {{1.f, 1.f, 1.f, 1.f, -1.f}, false},
+        {{1.f, 1.f, 1.f, 1.f, 1.f}, true},
+        {{.7f, 1.2f, .9f, 1.3f, .6f}, false},
+        {{1.f, 1.f, 1.f, 1.f, 1.f}, false},
+    };
+    const size_t fft_size = static_cast<size_t>(1) << kOrder;
+    // an odd step length, so the switches fall inside the hops
+    const size_t step_size = 5 * fft_size + 77;
+    const size_t num_samples = steps.size() * step_size;
+
+    std::mt19937 generator{42};
+    std::uniform_real_distribution<double> distribution{-.5, .5};
+    std::vector<double> fast_left(num_samples), fast_right(num_samples);
+    std::generate(fast_left.begin(), fast_left.end(), [&]() { return distribution(generator); });
+    // a partly correlated right channel, so mid and side both carry signal
+    for (size_t i = 0; i < num_samples; ++i) {
+        fast_right[i] = .6 * fast_left[i] + distribution(generator);
+    }
+    auto spectral_left{fast_left}, spectral_right{fast_right};
+
+    size_t num_gain_only{0};
+    for (size_t s = 0; s < steps.size(); ++s) {
+        if (steps[s].is_general) {
+            fast_corrections.setGeneral();
+            spectral_corrections.setGeneral();
+        } else {
+            fast_corrections.setGains(steps[s].gains);
+            spectral_corrections.setSpectralGains(steps[s].gains);
+        }
+        fast_corrections.apply(fast);
+        spectral_corrections.apply(spectral);
+        // the spectral reference always runs the STFT, so it has every non-identity bit except maybe mid and side
+        ZL_CHECK((spectral.getNonIdentityMask() & 28) == 28);
+        num_gain_only += steps[s].is_general ? 0 : 1;
+        process(fast, fast_left, fast_right, s * step_size, (s + 1) * step_size);
+        process(spectral, spectral_left, spectral_right, s * step_size, (s + 1) * step_size);
+    }
+    ZL_CHECK(num_gain_only == steps.size() - 1);
+
+    double max_error{0.0}, max_abs{0.0};
+    size_t max_error_pos{0};
+    for (size_t i = 0; i < num_samples; ++i) {
+        for (const auto error : {std::abs(fast_left[i] - spectral_left[i]), std::abs(fast_right[i] - spectral_right[i])}) {
+            if (error > max_error) {
+                max_error = error;
+                max_error_pos = i;
+            }
+        }
+        max_abs = std::max(max_abs, std::abs(spectral_left[i]));
+    }
+    std::printf("gain path vs spectral path: max abs %.4f, max error %.3e at step %zu\n",
+                max_abs, max_error, max_error_pos / step_size);
+    ZL_CHECK(max_abs > .1);
+    ZL_CHECK(max_error <= 1e-5 * max_abs);
+
+    // the cost per sample of each path, on one second at 48 kHz
+    std::vector<double> left(48000), right(48000);
+    std::generate(left.begin(), left.end(), [&]() { return distribution(generator); });
+    std::generate(right.begin(), right.end(), [&]() { return distribution(generator); });
+    const auto time_path = [&](Corrections& corrections, Processor& processor) {
+        corrections.apply(processor);
+        return zltest::timeNanoseconds([&]() { process(processor, left, right, 0, left.size()); }, 8)
+               / static_cast<double>(left.size());
+    };
+    fast_corrections.setGains({1.f, 1.f, 1.f, 1.f, 1.f});
+    const auto identity_ns = time_path(fast_corrections, fast);
+    fast_corrections.setGains({1.f, 1.f, 1.f, 1.f, .5f});
+    const auto gain_ns = time_path(fast_corrections, fast);
+    spectral_corrections.setSpectralGains({1.f, 1.f, 1.f, 1.f, .5f});
+    const auto spectral_ns = time_path(spectral_corrections, spectral);
+    std::printf("ns per sample: identity %.1f, gain %.1f, spectral %.1f\n", identity_ns, gain_ns, spectral_ns);
+    return zltest::finish();
+}
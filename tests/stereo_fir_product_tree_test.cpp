@@ -0,0 +1,111 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "test_helper.hpp"
+#include "zlp/stereo_fir_processor.hpp"
+
+namespace {
+    constexpr size_t kFilterNum = 8;
+    constexpr size_t kOrder = 9;
+    using Processor = zlp::StereoFIRProcessor<double, kFilterNum>;
+
+    void randomizeBand(zldsp::vector::aligned_vector<float>& real, zldsp::vector::aligned_vector<float>& imag,
+                       std::mt19937& generator) {
+        std::uniform_real_distribution<float> distribution{0.5f, 1.5f};
+        const auto scale = distribution(generator);
+        const auto freq = distribution(generator) * 0.02f;
+        for (size_t k = 0; k < real.size(); ++k) {
+            const auto phase = freq * static_cast<float>(k);
+            real[k] = scale * (0.8f + 0.2f * std::cos(phase));
+            imag[k] = scale * 0.3f * std::sin(phase);
+        }
+    }
+
+    /**
+     * @return the largest difference between the outputs of the two processors on the same noise
+     */
+    double compareOutputs(Processor& incremental, Processor& full, std::mt19937& generator) {
+        constexpr size_t kNumSamples = 4096;
+        std::uniform_real_distribution<double> distribution{-0.5, 0.5};
+        std::vector<double> left(kNumSamples), right(kNumSamples);
+        std::generate(left.begin(), left.end(), [&]() { return distribution(generator); });
+        std::generate(right.begin(), right.end(), [&]() { return distribution(generator); });
+        auto full_left{left}, full_right{right};
+        std::array<double*, 2> pointers{left.data(), right.data()};
+        std::array<double*, 2> full_pointers{full_left.data(), full_right.data()};
+        incremental.reset();
+        full.reset();
+        incremental.process<true, true, true, true, true>(std::span<double*>(pointers), kNumSamples, false);
+        full.process<true, true, true, true, true>(std::span<double*>(full_pointers), kNumSamples, false);
+        double max_error = 0.0;
+        for (size_t i = 0; i < kNumSamples; ++i) {
+            max_error = std::max(max_error, std::abs(left[i] - full_left[i]));
+            max_error = std::max(max_error, std::abs(right[i] - full_right[i]));
+        }
+        return max_error;
+    }
+}
+
+int main() {
+    std::unique_ptr<zldsp::fft::RFFT<float>> incremental_fft, full_fft;
+    Processor incremental{incremental_fft, kOrder, 0}, full{full_fft, kOrder, 0};
+    incremental.setOrder(kOrder);
+    full.setOrder(kOrder);
+
+    std::mt19937 generator{42};
+    std::array<zldsp::vector::aligned_vector<float>, kFilterNum> reals, imags;
+    for (size_t band = 0; band < kFilterNum; ++band) {
+        reals[band].resize(incremental.getNumBin());
+        imags[band].resize(incremental.getNumBin());
+        randomizeBand(reals[band], imags[band], generator);
+    }
+    // several types hold more than one band, so their products share the buffers
+    std::array<std::vector<size_t>, 5> on_indices{
+        std::vector<size_t>{0, 1, 2}, {3}, {}, {4, 5}, {6, 7}
+    };
+    incremental.updateCorrection(reals, imags, on_indices);
+    full.updateCorrection(reals, imags, on_indices);
+
+    std::uniform_int_distribution<size_t> band_distribution{0, kFilterNum - 1};
+    std::array<bool, kFilterNum> dirty_flags{};
+    double max_error = 0.0;
+    for (size_t step = 0; step < 32; ++step) {
+        std::ranges::fill(dirty_flags, false);
+        for (size_t n = 0; n < 1 + step % 3; ++n) {
+            const auto band = band_distribution(generator);
+            randomizeBand(reals[band], imags[band], generator);
+            dirty_flags[band] = true;
+        }
+        if (step % 8 == 7) {
+            // move one band to another type, which rebuilds all trees
+            const auto band = band_distribution(generator);
+            for (auto& indices : on_indices) {
+                std::erase(indices, band);
+            }
+            on_indices[(step / 8) % 5].emplace_back(band);
+            std::ranges::sort(on_indices[(step / 8) % 5]);
+        }
+        incremental.updateCorrection(reals, imags, on_indices, dirty_flags);
+        full.updateCorrection(reals, imags, on_indices);
+        ZL_CHECK(incremental.getNonIdentityMask() == full.getNonIdentityMask());
+        max_error = std::max(max_error, compareOutputs(incremental, full, generator));
+    }
+    std::printf("max error between the incremental and the full update: %.3e\n", max_error);
+    ZL_CHECK(max_error <= 1e-6);
+    return zltest::finish();
+}
@@ -0,0 +1,96 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "zlp/stereo_fir_processor.hpp"
+
+namespace {
+    constexpr size_t kFilterNum = 4;
+    // the order of the zero-phase correction at 48 kHz, which has the longest hop
+    constexpr size_t kOrder = 13;
+    constexpr size_t kBlockSize = 64;
+    constexpr size_t kNumCallbacks = 1 << 14;
+    // bucket b counts the callbacks which took [2^b, 2^(b+1)) microseconds, bucket 0 also counts faster ones
+    constexpr size_t kNumBuckets = 12;
+
+    using Processor = zlp::StereoFIRProcessor<double, kFilterNum>;
+
+    struct Histogram {
+        std::array<size_t, kNumBuckets> counts{};
+        double max_us{0.0};
+        double mean_us{0.0};
+    };
+
+    Histogram run(const bool is_amortised) {
+        std::unique_ptr<zldsp::fft::RFFT<float>> fft;
+        Processor processor{fft, kOrder, 0};
+        processor.setOrder(kOrder);
+        processor.setAmortised(is_amortised);
+
+        const auto num_bin = processor.getNumBin();
+        std::array<zldsp::vector::aligned_vector<float>, kFilterNum> reals, imags;
+        for (size_t band = 0; band < kFilterNum; ++band) {
+            reals[band].resize(num_bin);
+            imags[band].resize(num_bin);
+            for (size_t k = 0; k < num_bin; ++k) {
+                reals[band][k] = 0.8f + 0.3f * std::cos(0.013f * static_cast<float>(k * (band + 1)));
+                imags[band][k] = 0.2f * std::sin(0.021f * static_cast<float>(k * (band + 1)));
+            }
+        }
+        const std::array<std::vector<size_t>, 5> on_indices{std::vector<size_t>{0, 1}, {}, {}, {}, {2, 3}};
+        processor.updateCorrection(reals, imags, on_indices);
+
+        std::mt19937 generator{42};
+        std::uniform_real_distribution<double> distribution{-0.5, 0.5};
+        std::array<std::vector<double>, 2> buffers;
+        for (auto& buffer : buffers) {
+            buffer.resize(kBlockSize);
+        }
+        std::array<double*, 2> pointers{buffers[0].data(), buffers[1].data()};
+
+        Histogram histogram;
+        for (size_t i = 0; i < kNumCallbacks; ++i) {
+            for (auto& buffer : buffers) {
+                std::generate(buffer.begin(), buffer.end(), [&]() { return distribution(generator); });
+            }
+            const auto start = std::chrono::steady_clock::now();
+            processor.process<true, false, false, false, true>(std::span<double*>(pointers), kBlockSize, false);
+            const auto end = std::chrono::steady_clock::now();
+            const auto us = std::chrono::duration<double, std::micro>(end - start).count();
+            const auto bucket = us < 1.0 ? 0 : static_cast<size_t>(std::floor(std::log2(us)));
+            histogram.counts[std::min(bucket, kNumBuckets - 1)] += 1;
+            histogram.max_us = std::max(histogram.max_us, us);
+            histogram.mean_us += us / static_cast<double>(kNumCallbacks);
+        }
+        return histogram;
+    }
+}
+
+int main() {
+    const auto per_hop = run(false);
+    const auto amortised = run(true);
+    std::printf("per-callback time of %zu-sample callbacks, order %zu\n", kBlockSize, kOrder);
+    std::printf("%14s %10s %10s\n", "us", "per hop", "spread");
+    for (size_t b = 0; b < kNumBuckets; ++b) {
+        std::printf("%6zu - %5zu %10zu %10zu\n", b == 0 ? 0 : static_cast<size_t>(1) << b,
+                    static_cast<size_t>(1) << (b + 1), per_hop.counts[b], amortised.counts[b]);
+    }
+    std::printf("%14s %10.2f %10.2f\n", "mean", per_hop.mean_us, amortised.mean_us);
+    std::printf("%14s %10.2f %10.2f\n", "max", per_hop.max_us, amortised.max_us);
+    return 0;
+}
@@ -0,0 +1,112 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "test_helper.hpp"
+#include "zlp/stereo_fir_processor.hpp"
+
+namespace {
+    constexpr size_t kFilterNum = 4;
+    constexpr size_t kOrder = 10;
+    using Processor = zlp::StereoFIRProcessor<double, kFilterNum>;
+
+    /**
+     * two general (non gain-only) band corrections on the stereo type, so every frame goes through the STFT
+     */
+    struct Corrections {
+        std::array<zldsp::vector::aligned_vector<float>, kFilterNum> reals, imags;
+        std::array<std::vector<size_t>, 5> on_indices{std::vector<size_t>{0, 2}, {}, {}, {}, {}};
+
+        explicit Corrections(const size_t num_bin) {
+            for (size_t band = 0; band < kFilterNum; ++band) {
+                reals[band].resize(num_bin);
+                imags[band].resize(num_bin);
+                for (size_t k = 0; k < num_bin; ++k) {
+                    const auto w = static_cast<float>(k) * static_cast<float>(band + 1);
+                    reals[band][k] = 0.8f + 0.3f * std::cos(0.013f * w);
+                    imags[band][k] = 0.2f * std::sin(0.021f * w);
+                }
+            }
+        }
+    };
+
+    void process(Processor& processor, std::vector<double>& left, std::vector<double>& right,
+                 const std::vector<size_t>& block_sizes) {
+        size_t start = 0;
+        for (size_t i = 0; start < left.size(); ++i) {
+            const auto num_samples = std::min(block_sizes[i % block_sizes.size()], left.size() - start);
+            std::array<double*, 2> pointers{left.data() + start, right.data() + start};
+            processor.process<true, false, false, false, false>(std::span<double*>(pointers), num_samples, false);
+            start += num_samples;
+        }
+    }
+}
+
+int main() {
+    std::unique_ptr<zldsp::fft::RFFT<float>> sync_fft, amortised_fft;
+    Processor sync{sync_fft, kOrder, 0}, amortised{amortised_fft, kOrder, 0};
+    sync.setOrder(kOrder);
+    sync.reset();
+    amortised.setOrder(kOrder);
+    amortised.setAmortised(true);
+
+    const size_t fft_size = static_cast<size_t>(1) << kOrder;
+    const size_t hop_size = fft_size / 4;
+    ZL_CHECK(amortised.getLatency() == sync.getLatency() + static_cast<int>(hop_size));
+
+    Corrections corrections{sync.getNumBin()};
+    sync.updateCorrection(corrections.reals, corrections.imags, corrections.on_indices);
+    amortised.updateCorrection(corrections.reals, corrections.imags, corrections.on_indices);
+    ZL_CHECK(sync.getNonIdentityMask() == 16);
+
+    std::mt19937 generator{42};
+    std::uniform_real_distribution<double> distribution{-0.5, 0.5};
+    std::uniform_int_distribution<size_t> block_distribution{1, 700};
+    std::vector<size_t> random_block_sizes(64);
+    std::generate(random_block_sizes.begin(), random_block_sizes.end(), [&]() {
+        return block_distribution(generator);
+    });
+
+    // the second pass follows a reset, as on a structure switch, so a frame left pending must not leak into it
+    for (size_t pass = 0; pass < 2; ++pass) {
+        const size_t num_samples = 24 * hop_size;
+        std::vector<double> left(num_samples), right(num_samples);
+        std::generate(left.begin(), left.end(), [&]() { return distribution(generator); });
+        std::generate(right.begin(), right.end(), [&]() { return distribution(generator); });
+        auto sync_left{left}, sync_right{right};
+        // the stages run at fixed sample counts, so the block sizes of the host do not matter
+        process(sync, sync_left, sync_right, {512});
+        process(amortised, left, right, random_block_sizes);
+
+        double max_error = 0.0, max_abs = 0.0;
+        for (size_t i = 0; i + hop_size < num_samples; ++i) {
+            max_error = std::max(max_error, std::abs(left[i + hop_size] - sync_left[i]));
+            max_error = std::max(max_error, std::abs(right[i + hop_size] - sync_right[i]));
+            max_abs = std::max(max_abs, std::abs(sync_left[i]));
+        }
+        for (size_t i = 0; i < hop_size; ++i) {
+            max_error = std::max(max_error, std::abs(left[i]) + std::abs(right[i]));
+        }
+        std::printf("pass %zu: max abs %.4f, max error %.3e\n", pass, max_abs, max_error);
+        ZL_CHECK(max_abs > 0.01);
+        ZL_CHECK(max_error <= 1e-6);
+
+        sync.reset();
+        amortised.reset();
+    }
+    return zltest::finish();
+}
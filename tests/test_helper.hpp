@@ -0,0 +1,57 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+
+namespace zltest {
+    inline int& getNumFailures() {
+        static int num_failures = 0;
+        return num_failures;
+    }
+
+    inline void check(const bool condition, const char* expression, const char* file, const int line) {
+        if (!condition) {
+            std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expression);
+            getNumFailures() += 1;
+        }
+    }
+
+    /**
+     * @return the exit code of the test
+     */
+    inline int finish() {
+        if (getNumFailures() > 0) {
+            std::fprintf(stderr, "%d check(s) failed\n", getNumFailures());
+            return 1;
+        }
+        return 0;
+    }
+
+    /**
+     * run the function several times and return the fastest run in nanoseconds
+     */
+    template <typename Func>
+    double timeNanoseconds(Func&& func, const int num_runs = 16) {
+        double best = 1e300;
+        for (int run = 0; run < num_runs; ++run) {
+            const auto start = std::chrono::steady_clock::now();
+            func();
+            const auto end = std::chrono::steady_clock::now();
+            const auto duration = std::chrono::duration<double, std::nano>(end - start).count();
+            best = duration < best ? duration : best;
+        }
+        return best;
+    }
+}
+
+#define ZL_CHECK(condition) zltest::check((condition), #condition, __FILE__, __LINE__)
@@ -0,0 +1,122 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "test_helper.hpp"
+#include "dsp/filter/iir_filter/tdf/tdf.hpp"
+#include "dsp/vector/vector.hpp"
+
+namespace {
+    constexpr size_t kBandNum = 8;
+    constexpr size_t kTileSize = 256;
+    constexpr double kSampleRate = 48000.0;
+
+    using TDF = zldsp::filter::TDF<double, 16>;
+
+    /**
+     * a JUCE-free stand-in for the controller chain: pre copy, side copy + side filter and main filter per band,
+     * then a pre/post power measurement and an output gain
+     */
+    class ChainProxy {
+    public:
+        explicit ChainProxy(const size_t max_num_samples) {
+            for (size_t chan = 0; chan < 2; ++chan) {
+                pre_buffers_[chan].resize(max_num_samples);
+                side_buffers_[chan].resize(max_num_samples);
+            }
+            for (size_t i = 0; i < kBandNum; ++i) {
+                const auto freq = 50.0 * static_cast<double>(1 << i);
+                main_filters_[i].prepare(kSampleRate, 2, max_num_samples);
+                main_filters_[i].forceUpdate({zldsp::filter::kPeak, 2, freq, 3.0, 0.707});
+                side_filters_[i].prepare(kSampleRate, 2, max_num_samples);
+                side_filters_[i].forceUpdate({zldsp::filter::kBandPass, 2, freq, 0.0, 0.707});
+            }
+        }
+
+        double process(std::array<double*, 2> main_pointers, std::array<double*, 2> side_pointers,
+                       const size_t num_samples, const size_t offset) {
+            std::array<double*, 2> pre_pointers{pre_buffers_[0].data() + offset, pre_buffers_[1].data() + offset};
+            std::array<double*, 2> side_copy_pointers{side_buffers_[0].data(), side_buffers_[1].data()};
+            zldsp::vector::copy(std::span<double*>(pre_pointers), std::span<double*>(main_pointers), num_samples);
+            double pre_power = 0.0;
+            for (size_t chan = 0; chan < 2; ++chan) {
+                pre_power += zldsp::vector::sum_sqr(main_pointers[chan], num_samples);
+            }
+            for (size_t i = 0; i < kBandNum; ++i) {
+                zldsp::vector::copy(std::span<double*>(side_copy_pointers), std::span<double*>(side_pointers), num_samples);
+                side_filters_[i].process(side_copy_pointers, num_samples);
+                main_filters_[i].process(main_pointers, num_samples);
+            }
+            double post_power = 0.0;
+            for (size_t chan = 0; chan < 2; ++chan) {
+                post_power += zldsp::vector::sum_sqr(main_pointers[chan], num_samples);
+                zldsp::vector::multiply(main_pointers[chan], 0.5, num_samples);
+            }
+            return pre_power + post_power + side_copy_pointers[0][0];
+        }
+
+    private:
+        std::array<TDF, kBandNum> main_filters_, side_filters_;
+        std::array<std::vector<double>, 2> pre_buffers_, side_buffers_;
+    };
+}
+
+int main() {
+    std::mt19937 generator{42};
+    std::uniform_real_distribution<double> distribution{-0.5, 0.5};
+    volatile double sink = 0.0;
+
+    std::printf("%10s %16s %16s %8s\n", "block", "whole (ns/smp)", "tiled (ns/smp)", "ratio");
+    for (const size_t block_size : {256, 1024, 2048, 4096, 8192}) {
+        std::array<std::vector<double>, 2> input_buffers, main_buffers, side_buffers;
+        for (size_t chan = 0; chan < 2; ++chan) {
+            input_buffers[chan].resize(block_size);
+            main_buffers[chan].resize(block_size);
+            side_buffers[chan].resize(block_size);
+            std::generate(input_buffers[chan].begin(), input_buffers[chan].end(), [&]() {
+                return distribution(generator);
+            });
+            std::generate(side_buffers[chan].begin(), side_buffers[chan].end(), [&]() {
+                return distribution(generator);
+            });
+        }
+        std::array<double*, 2> main_pointers{main_buffers[0].data(), main_buffers[1].data()};
+        std::array<double*, 2> side_pointers{side_buffers[0].data(), side_buffers[1].data()};
+
+        // both variants restore the input first, so repeated runs do not drift into denormals
+        const auto restore = [&]() {
+            for (size_t chan = 0; chan < 2; ++chan) {
+                zldsp::vector::copy(main_buffers[chan].data(), input_buffers[chan].data(), block_size);
+            }
+        };
+        ChainProxy whole{block_size}, tiled{block_size};
+        const auto whole_ns = zltest::timeNanoseconds([&]() {
+            restore();
+            sink = sink + whole.process(main_pointers, side_pointers, block_size, 0);
+        }, 64);
+        const auto tiled_ns = zltest::timeNanoseconds([&]() {
+            restore();
+            for (size_t start = 0; start < block_size; start += kTileSize) {
+                const auto tile_size = std::min(kTileSize, block_size - start);
+                sink = sink + tiled.process({main_pointers[0] + start, main_pointers[1] + start},
+                                            {side_pointers[0] + start, side_pointers[1] + start},
+                                            tile_size, start);
+            }
+        }, 64);
+        const auto num = static_cast<double>(block_size);
+        std::printf("%10zu %16.3f %16.3f %8.3f\n", block_size, whole_ns / num, tiled_ns / num, whole_ns / tiled_ns);
+    }
+    return 0;
+}
@@ -0,0 +1,90 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLEqualizer
+//
+// ZLEqualizer is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLEqualizer is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLEqualizer. If not, see <https://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include <hwy/targets.h>
+
+#include "test_helper.hpp"
+#include "dsp/vector/vector.hpp"
+#include "dsp/filter/ideal_filter/ideal_batch.hpp"
+
+namespace {
+    volatile double sink = 0.0;
+
+    /**
+     * time the dispatched kernels on the target chosen at the moment, in nanoseconds per element
+     * the IdealBatch column evaluates 8 magnitude jobs of 4 stages each, in nanoseconds per grid point
+     */
+    void benchTarget(const size_t size) {
+        static constexpr size_t kNumJobs = 8, kNumStages = 4;
+        std::mt19937 generator{42};
+        std::uniform_real_distribution<float> distribution{1e-3f, 1.f};
+        std::vector<float> in_f(size), out_f(size);
+        std::vector<double> in_d(size), in_d2(size);
+        std::generate(in_f.begin(), in_f.end(), [&]() { return distribution(generator); });
+        std::generate(in_d.begin(), in_d.end(), [&]() { return static_cast<double>(distribution(generator)); });
+        std::generate(in_d2.begin(), in_d2.end(), [&]() { return static_cast<double>(distribution(generator)); });
+
+        const auto num = static_cast<double>(size);
+        const auto sum_sqr_ns = zltest::timeNanoseconds([&]() {
+            sink = sink + static_cast<double>(zldsp::vector::sum_sqr(in_f.data(), size));
+        }, 256) / num;
+        const auto dot_ns = zltest::timeNanoseconds([&]() {
+            sink = sink + zldsp::vector::dot_product(in_d.data(), in_d2.data(), size);
+        }, 256) / num;
+        const auto max_abs_ns = zltest::timeNanoseconds([&]() {
+            sink = sink + static_cast<double>(zldsp::vector::max_abs_of(in_f.data(), size));
+        }, 256) / num;
+        const auto to_db_ns = zltest::timeNanoseconds([&]() {
+            zldsp::vector::sqr_mag_to_db(out_f.data(), in_f.data(), size);
+            sink = sink + static_cast<double>(out_f[0]);
+        }, 256) / num;
+
+        std::vector<float> ws(size);
+        for (size_t i = 0; i < size; ++i) {
+            ws[i] = 0.01f + 3.f * static_cast<float>(i) / static_cast<float>(size);
+        }
+        std::array<std::array<double, 5>, kNumStages> coeffs{};
+        for (size_t s = 0; s < kNumStages; ++s) {
+            const auto w0 = 0.1 + 0.5 * static_cast<double>(s);
+            coeffs[s] = {w0 / 0.7, w0 * w0, 1.0, w0 * 1.4, w0 * w0};
+        }
+        std::vector<std::vector<float>> mags(kNumJobs, std::vector<float>(size));
+        zldsp::filter::IdealBatch<float, kNumJobs * kNumStages, kNumJobs> batch;
+        batch.prepare(ws);
+        for (auto& mag : mags) {
+            batch.addMagnitudeSquare(coeffs, mag);
+        }
+        const auto batch_ns = zltest::timeNanoseconds([&]() {
+            batch.process();
+            sink = sink + static_cast<double>(mags[0][0]);
+        }, 256) / num;
+        std::printf("%10s %8zu %12.4f %12.4f %12.4f %12.4f %12.4f\n", zldsp::vector::dispatch::getTargetName(), size,
+                    sum_sqr_ns, dot_ns, max_abs_ns, to_db_ns, batch_ns);
+    }
+}
+
+int main() {
+    std::printf("%10s %8s %12s %12s %12s %12s %12s\n", "target", "size",
+                "sum_sqr f32", "dot f64", "max_abs f32", "to_db f32", "batch f32");
+    // in a static build there is a single target, with dynamic dispatch every compiled target the CPU supports
+    for (const auto target : hwy::SupportedAndGeneratedTargets()) {
+        hwy::SetSupportedTargetsForTest(target);
+        for (const size_t size : {64, 1024, 16384}) {
+            benchTarget(size);
+        }
+    }
+    hwy::SetSupportedTargetsForTest(0);
+    return 0;
+}